@@ -0,0 +1,347 @@
+/*
+  Benchmark example using GEM library.
+
+  Measures time (in microseconds) that GEM spends drawing the menu and handling key presses
+  on the actual hardware, so the results of changes made to the library (or to the sketch) can be compared
+  against each other. The following operations are timed on a short page (one of each of the menu item types)
+  on a long page (32 editable int items) and on a page of six float items:
+    - full frame: drawMenu();
+    - separate drawing phases: printMenuItems(), drawScrollbar();
+    - navigation through the menu items list;
+    - edit mode of int, float, char[], select and spinner menu items;
+    - conversion of float values to strings and back (GEMFormat used by GEM against dtostrf() and atof()).
+
+  Results are printed to Serial monitor as a table once at startup. When profiling is enabled in config.h
+  (GEM_ENABLE_PROFILING), count of draw primitives (pixels, chars, rects, lines, bitmaps) and time spent
+  in each of the phases of the frame is printed as well. Results of the float page can be compared with caching
+  of formatted values enabled (GEM_ENABLE_VALUE_CACHE) to see how much time formatting of values takes.
+  Frame timings can also be compared between regular build, Advanced Mode (GEM_ENABLE_ADVANCED_MODE) and Advanced Mode
+  with statically bound per-row draw helpers (GEM_ENABLE_STATIC_DRAW); mode is printed in the header of the table.
+
+  AltSerialGraphicLCD library is used to draw menu.
+  
+  Additional info (including the breadboard view) available on GitHub:
+  https://github.com/Spirik/GEM
+  
+  This example code is in the public domain.
+*/
+
+#include <GEM.h>
+
+// Constants for the pins SparkFun Graphic LCD Serial Backpack is connected to and SoftwareSerial object
+const byte rxPin = 8;
+const byte txPin = 9;
+SoftwareSerial serialLCD(rxPin, txPin);
+
+// Create an instance of the GLCD class. This instance is used to call all the subsequent GLCD functions
+// (internally from GEM library, or manually in your sketch if it is required)
+GLCD glcd(serialLCD);
+
+// Number of times each of the operations is repeated (result is averaged)
+const int iterations = 20;
+
+// Variables of every type supported by GEM, editable through the short menu page
+int number = -512;
+byte level = 64;
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+float ratio = 3.141592;
+#endif
+char label[GEM_STR_LEN] = "Benchmark";
+bool enabled = true;
+byte tempo = 2;
+int speed = 100;
+
+SelectOptionByte selectTempoOptions[] = {{"Slow", 0}, {"Normal", 1}, {"Fast", 2}, {"Faster", 3}};
+GEMSelect selectTempo(sizeof(selectTempoOptions)/sizeof(SelectOptionByte), selectTempoOptions);
+
+#ifdef GEM_SUPPORT_SPINNER
+GEMSpinnerBoundariesInt spinnerSpeedBoundaries = { .step = 10, .min = 0, .max = 1000 };
+GEMSpinner spinnerSpeed(spinnerSpeedBoundaries);
+#endif
+
+void buttonAction() {}
+
+GEMItem menuItemInt("Number:", number);
+GEMItem menuItemByte("Level:", level);
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+GEMItem menuItemFloat("Ratio:", ratio);
+#endif
+GEMItem menuItemChar("Label:", label);
+GEMItem menuItemBool("Enabled:", enabled);
+GEMItem menuItemSelect("Tempo:", tempo, selectTempo);
+#ifdef GEM_SUPPORT_SPINNER
+GEMItem menuItemSpinner("Speed:", speed, spinnerSpeed);
+#endif
+GEMItem menuItemButton("Button", buttonAction);
+
+// Long menu page with 32 editable int items
+int longValues[32];
+GEMItem longItems[] = {
+  {"Value 0:", longValues[0]},
+  {"Value 1:", longValues[1]},
+  {"Value 2:", longValues[2]},
+  {"Value 3:", longValues[3]},
+  {"Value 4:", longValues[4]},
+  {"Value 5:", longValues[5]},
+  {"Value 6:", longValues[6]},
+  {"Value 7:", longValues[7]},
+  {"Value 8:", longValues[8]},
+  {"Value 9:", longValues[9]},
+  {"Value 10:", longValues[10]},
+  {"Value 11:", longValues[11]},
+  {"Value 12:", longValues[12]},
+  {"Value 13:", longValues[13]},
+  {"Value 14:", longValues[14]},
+  {"Value 15:", longValues[15]},
+  {"Value 16:", longValues[16]},
+  {"Value 17:", longValues[17]},
+  {"Value 18:", longValues[18]},
+  {"Value 19:", longValues[19]},
+  {"Value 20:", longValues[20]},
+  {"Value 21:", longValues[21]},
+  {"Value 22:", longValues[22]},
+  {"Value 23:", longValues[23]},
+  {"Value 24:", longValues[24]},
+  {"Value 25:", longValues[25]},
+  {"Value 26:", longValues[26]},
+  {"Value 27:", longValues[27]},
+  {"Value 28:", longValues[28]},
+  {"Value 29:", longValues[29]},
+  {"Value 30:", longValues[30]},
+  {"Value 31:", longValues[31]}
+};
+
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+// Menu page with six float items (formatting of their values takes most of the time spent drawing them)
+float floatValues[6] = {0.5, 1.25, -3.75, 10.125, 100.0625, -0.03125};
+GEMItem floatItems[] = {
+  {"Float 0:", floatValues[0]},
+  {"Float 1:", floatValues[1]},
+  {"Float 2:", floatValues[2]},
+  {"Float 3:", floatValues[3]},
+  {"Float 4:", floatValues[4]},
+  {"Float 5:", floatValues[5]}
+};
+GEMPage menuPageFloat("Float Page");
+#endif
+
+GEMPage menuPageShort("Short Page");
+GEMPage menuPageLong("Long Page");
+GEMItem menuItemLinkLong("Long Page", menuPageLong);
+
+// Derived class that provides access to the separate drawing phases of GEM
+// (these are protected members of the class, not meant to be called directly in regular sketches)
+class GEMBenchmark : public GEM {
+  public:
+    GEMBenchmark(GLCD& glcd_) : GEM(glcd_, GEM_POINTER_ROW, GEM_ITEMS_COUNT_AUTO) {}
+    void benchPrintMenuItems() {
+      printMenuItems();
+    }
+    void benchDrawScrollbar() {
+      drawScrollbar();
+    }
+};
+
+GEMBenchmark menu(glcd);
+
+void setup() {
+  // Serial communications setup
+  Serial.begin(115200);
+  serialLCD.begin(115200);
+
+  // LCD reset
+  delay(500);
+  glcd.reset();
+  delay(1000);
+
+  // Splash screen is not relevant to measurements
+  menu.setSplashDelay(0);
+  menu.init();
+  setupMenu();
+  menu.drawMenu();
+
+  runBenchmark();
+}
+
+void setupMenu() {
+  menuPageShort.addMenuItem(menuItemInt);
+  menuPageShort.addMenuItem(menuItemByte);
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  menuPageShort.addMenuItem(menuItemFloat);
+  #endif
+  menuPageShort.addMenuItem(menuItemChar);
+  menuPageShort.addMenuItem(menuItemBool);
+  menuPageShort.addMenuItem(menuItemSelect);
+  #ifdef GEM_SUPPORT_SPINNER
+  menuPageShort.addMenuItem(menuItemSpinner);
+  #endif
+  menuPageShort.addMenuItem(menuItemButton);
+  menuPageShort.addMenuItem(menuItemLinkLong);
+
+  for (byte i = 0; i < sizeof(longItems)/sizeof(GEMItem); i++) {
+    menuPageLong.addMenuItem(longItems[i]);
+  }
+  menuPageLong.setParentMenuPage(menuPageShort);
+
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  for (byte i = 0; i < sizeof(floatItems)/sizeof(GEMItem); i++) {
+    menuPageFloat.addMenuItem(floatItems[i]);
+  }
+  #endif
+
+  menu.setMenuPageCurrent(menuPageShort);
+}
+
+void loop() {
+  // Nothing to do here: results are printed once in setup()
+}
+
+// Print averaged time of the operation in microseconds
+void report(const char* name, unsigned long elapsed) {
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.println(elapsed / iterations);
+}
+
+#ifdef GEM_ENABLE_PROFILING
+// Print count of draw primitives and time spent in each of the phases of the last frame
+void reportProfile() {
+  const char* phases[] = {"  title", "  items", "  pointer", "  scrollbar", "  callback", "  other"};
+  GEMProfileFrame* frame = menu.getProfiler().getFrame();
+  for (byte i = 0; i < GEM_PROFILE_PHASES; i++) {
+    Serial.print(phases[i]);
+    for (byte j = 0; j < GEM_PRIMITIVES; j++) {
+      Serial.print("\t");
+      Serial.print(frame->phases[i].primitives[j]);
+    }
+    Serial.print("\t");
+    Serial.println(frame->phases[i].micros);
+  }
+}
+#endif
+
+// Move menu pointer to the menu item with supplied index on the current page
+void selectMenuItem(GEMPage& page, byte index) {
+  page.setCurrentMenuItemIndex(index);
+  menu.drawMenu();
+}
+
+// Time full frame and drawing phases of the page
+void benchPage(GEMPage& page, const char* name) {
+  unsigned long start;
+  menu.setMenuPageCurrent(page);
+  selectMenuItem(page, 0);
+  Serial.print("-- ");
+  Serial.println(name);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    menu.drawMenu();
+  }
+  report("drawMenu", micros() - start);
+  #ifdef GEM_ENABLE_PROFILING
+  reportProfile();
+  #endif
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    menu.benchPrintMenuItems();
+  }
+  report("printMenuItems", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    menu.benchDrawScrollbar();
+  }
+  report("drawScrollbar", micros() - start);
+
+  // Each key press results in menu pointer moving to the next (or previous) menu item
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    menu.registerKeyPress((i / page.getItemsCount()) % 2 ? GEM_KEY_UP : GEM_KEY_DOWN);
+  }
+  report("navigate", micros() - start);
+}
+
+// Time edit mode of the menu item with supplied index: enter edit mode, change value iterations times, exit edit mode without saving
+void benchEdit(GEMPage& page, byte index, const char* name) {
+  unsigned long start;
+  menu.setMenuPageCurrent(page);
+  selectMenuItem(page, index);
+
+  start = micros();
+  menu.registerKeyPress(GEM_KEY_OK);
+  for (int i = 0; i < iterations; i++) {
+    menu.registerKeyPress(GEM_KEY_UP);
+  }
+  menu.registerKeyPress(GEM_KEY_CANCEL);
+  report(name, micros() - start);
+}
+
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+// Time conversion of float values to strings (with precision of 6 digits) and back
+void benchFormat() {
+  unsigned long start;
+  char valueString[GEM_STR_LEN];
+  volatile float value = 0;
+  Serial.println("-- Float conversion");
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    dtostrf(floatValues[i % 6], 7, 6, valueString);
+  }
+  report("dtostrf", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    GEMFormat::formatFloat(floatValues[i % 6], 6, valueString);
+  }
+  report("formatFloat", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    value = atof("-123.456789");
+  }
+  report("atof", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    value = GEMFormat::parseFloat("-123.456789");
+  }
+  report("parseFloat", micros() - start);
+}
+#endif
+
+void runBenchmark() {
+  Serial.println("GEM benchmark, us per operation");
+  #if defined(GEM_ENABLE_ADVANCED_MODE) && defined(GEM_ENABLE_STATIC_DRAW)
+  Serial.println("Mode: Advanced Mode (static draw)");
+  #elif defined(GEM_ENABLE_ADVANCED_MODE)
+  Serial.println("Mode: Advanced Mode (virtual)");
+  #else
+  Serial.println("Mode: regular");
+  #endif
+  benchPage(menuPageShort, "Short page");
+  benchPage(menuPageLong, "Long page");
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  benchPage(menuPageFloat, "Float page");
+  benchFormat();
+  #endif
+
+  Serial.println("-- Edit mode");
+  byte index = 0;
+  benchEdit(menuPageShort, index++, "int");
+  index++; // byte
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  benchEdit(menuPageShort, index++, "float");
+  #endif
+  benchEdit(menuPageShort, index++, "char[]");
+  index++; // bool
+  benchEdit(menuPageShort, index++, "select");
+  #ifdef GEM_SUPPORT_SPINNER
+  benchEdit(menuPageShort, index++, "spinner");
+  #endif
+
+  menu.setMenuPageCurrent(menuPageShort);
+  selectMenuItem(menuPageShort, 0);
+}
@@ -0,0 +1,123 @@
+/*
+  In-memory mock of Adafruit GFX library for GEM library host harness (see include/Adafruit_GFX.h).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <Adafruit_GFX.h>
+
+Adafruit_GFX::Adafruit_GFX() {
+  memset(frame, 0, sizeof(frame));
+}
+
+void Adafruit_GFX::setPixel(int x, int y, uint16_t color) {
+  if (x >= 0 && x < W && y >= 0 && y < H) {
+    frame[y][x] = color;
+    pixels++;
+  }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, W, H, color);
+}
+
+void Adafruit_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  ops++;
+  setPixel(x, y, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  ops++;
+  for (int j = y; j < y + h; j++) {
+    for (int i = x; i < x + w; i++) {
+      setPixel(i, j, color);
+    }
+  }
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  ops++;
+  int dx = x1 - x0;
+  int dy = y1 - y0;
+  int n = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+  for (int k = 0; k <= n; k++) {
+    setPixel(x0 + (n ? dx * k / n : 0), y0 + (n ? dy * k / n : 0), color);
+  }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+  ops++;
+  int rowBytes = (w + 7) / 8;
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < w; i++) {
+      if (bitmap[j * rowBytes + i / 8] & (0x80 >> (i & 7))) {
+        setPixel(x + i, y + j, color);
+      }
+    }
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  ops++;
+  if (_font == nullptr) {
+    // Built-in 5x7 font in 6x8 cell with top left corner at (x, y); background is drawn unless it matches color
+    for (int i = 0; i < 6; i++) {
+      for (int j = 0; j < 8; j++) {
+        bool on = i < 5 && j < 7 && (c * 31 + i * 7 + j * 13) % 3 == 0;
+        if (on || bg != color) {
+          for (int sy = 0; sy < size; sy++) {
+            for (int sx = 0; sx < size; sx++) {
+              setPixel(x + i * size + sx, y + j * size + sy, on ? color : bg);
+            }
+          }
+        }
+      }
+    }
+  } else {
+    // GFX font, (x, y) is on the baseline; background is never drawn (same as in Adafruit GFX)
+    GFXglyph* glyph = &_font->glyph[c - _font->first];
+    uint8_t* bitmap = _font->bitmap;
+    uint16_t offset = glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (int yy = 0; yy < glyph->height; yy++) {
+      for (int xx = 0; xx < glyph->width; xx++) {
+        if (!(bit++ & 7)) {
+          bits = bitmap[offset++];
+        }
+        if (bits & 0x80) {
+          for (int sy = 0; sy < size; sy++) {
+            for (int sx = 0; sx < size; sx++) {
+              setPixel(x + (glyph->xOffset + xx) * size + sx, y + (glyph->yOffset + yy) * size + sy, color);
+            }
+          }
+        }
+        bits <<= 1;
+      }
+    }
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (_font == nullptr) {
+    if (c == '\n') {
+      _cursorX = 0;
+      _cursorY += 8 * _textSize;
+    } else if (c != '\r') {
+      drawChar(_cursorX, _cursorY, c, _textColor, _textBackground, _textSize);
+      _cursorX += 6 * _textSize;
+    }
+  } else {
+    if (c == '\n') {
+      _cursorX = 0;
+      _cursorY += _font->yAdvance * _textSize;
+    } else if (c != '\r' && c >= _font->first && c <= _font->last) {
+      GFXglyph* glyph = &_font->glyph[c - _font->first];
+      if (glyph->width > 0 && glyph->height > 0) {
+        drawChar(_cursorX, _cursorY, c, _textColor, _textBackground, _textSize);
+      }
+      _cursorX += glyph->xAdvance * _textSize;
+    }
+  }
+  return 1;
+}
@@ -0,0 +1,145 @@
+/*
+  In-memory mock of AltSerialGraphicLCD library for GEM library host harness (see include/AltSerialGraphicLCD.h).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <AltSerialGraphicLCD.h>
+
+GLCD::GLCD() {
+  memset(frame, 0, sizeof(frame));
+}
+
+// Pixel operation of the backpack: set pixel ('on') or its background (not 'on') according to mode
+void GLCD::setPixel(int x, int y, bool on, uint8_t mode) {
+  if (x >= 0 && x < W && y >= 0 && y < H) {
+    switch (mode) {
+      case GLCD_MODE_XOR:
+        frame[y][x] ^= on;
+        break;
+      case GLCD_MODE_REVERSE:
+        frame[y][x] = !on;
+        break;
+      default:
+        frame[y][x] = on;
+        break;
+    }
+  }
+}
+
+void GLCD::clearScreen() {
+  ops++;
+  bytes += 2;
+  memset(frame, 0, sizeof(frame));
+}
+
+void GLCD::drawPixel(uint8_t x, uint8_t y, uint8_t mode) {
+  ops++;
+  bytes += 5;
+  setPixel(x, y, true, mode);
+}
+
+void GLCD::drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode) {
+  ops++;
+  bytes += 7;
+  int dx = x2 - x1;
+  int dy = y2 - y1;
+  int n = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+  for (int k = 0; k <= n; k++) {
+    setPixel(x1 + (n ? dx * k / n : 0), y1 + (n ? dy * k / n : 0), true, mode);
+  }
+}
+
+void GLCD::drawBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode) {
+  ops++;
+  bytes += 7;
+  for (int x = x1; x <= x2; x++) {
+    setPixel(x, y1, true, mode);
+    if (y2 != y1) {
+      setPixel(x, y2, true, mode);
+    }
+  }
+  for (int y = y1 + 1; y < y2; y++) {
+    setPixel(x1, y, true, mode);
+    if (x2 != x1) {
+      setPixel(x2, y, true, mode);
+    }
+  }
+}
+
+// Box is filled with vertical 8-pixel pattern 'fill' in current draw mode
+void GLCD::fillBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t fill) {
+  ops++;
+  bytes += 7;
+  for (int y = y1; y <= y2; y++) {
+    for (int x = x1; x <= x2; x++) {
+      setPixel(x, y, (fill >> (y & 7)) & 1, _drawMode);
+    }
+  }
+}
+
+void GLCD::eraseBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+  ops++;
+  bytes += 6;
+  for (int y = y1; y <= y2; y++) {
+    for (int x = x1; x <= x2; x++) {
+      setPixel(x, y, false, GLCD_MODE_NORMAL);
+    }
+  }
+}
+
+// Bitmap data: width, height, then columns of 8 vertical pixels (least significant bit on top) for each 8-pixel band
+void GLCD::blit(uint8_t x, uint8_t y, uint8_t mode, const uint8_t* data) {
+  uint8_t w = pgm_read_byte(data);
+  uint8_t h = pgm_read_byte(data + 1);
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < w; i++) {
+      if ((pgm_read_byte(data + 2 + (j / 8) * w + i) >> (j & 7)) & 1) {
+        setPixel(x + i, y + j, true, mode);
+      }
+    }
+  }
+}
+
+void GLCD::bitblt_P(uint8_t x, uint8_t y, uint8_t mode, const uint8_t* data) {
+  ops++;
+  bytes += 7 + pgm_read_byte(data) * ((pgm_read_byte(data + 1) + 7) / 8);
+  blit(x, y, mode, data);
+}
+
+void GLCD::loadSprite_P(uint8_t id, const uint8_t* data) {
+  ops++;
+  bytes += 5 + pgm_read_byte(data) * ((pgm_read_byte(data + 1) + 7) / 8);
+  if (id < SPRITES) {
+    _sprites[id] = data;
+  }
+}
+
+void GLCD::drawSprite(uint8_t x, uint8_t y, uint8_t id, uint8_t mode) {
+  ops++;
+  bytes += 6;
+  if (id < SPRITES && _sprites[id] != nullptr) {
+    blit(x, y, mode, _sprites[id]);
+  }
+}
+
+// Character cell of the font face is drawn at current position, which then advances to the next cell
+void GLCD::put(char c) {
+  ops++;
+  bytes += 1;
+  int w = _fontFace ? 4 : 6;
+  int h = _fontFace ? 6 : 8;
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < w; i++) {
+      bool on = i < w - 1 && j < h - 1 && ((unsigned char)c * 31 + i * 7 + j * 13) % 3 == 0;
+      setPixel(_x + i, _y + j, on, _fontMode);
+    }
+  }
+  _x += w;
+}
+
+void GLCD::putstr(char* str) {
+  while (*str) {
+    put(*str++);
+  }
+}
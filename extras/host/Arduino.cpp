@@ -0,0 +1,117 @@
+/*
+  Minimal Arduino core for building GEM library on a desktop host (see "Host build" section of README.md).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <time.h>
+
+HardwareSerial Serial;
+
+static unsigned long delayed = 0; // Total of delay() calls, in microseconds
+
+unsigned long micros() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return delayed + now.tv_sec * 1000000UL + now.tv_nsec / 1000;
+}
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+  delayed += ms * 1000;
+}
+
+char* dtostrf(double val, signed char width, unsigned char prec, char* sout) {
+  sprintf(sout, "%*.*f", width, prec, val);
+  return sout;
+}
+
+char* ltoa(long value, char* str, int base) {
+  if (base == 10) {
+    sprintf(str, "%ld", value);
+  } else {
+    const char* digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+    unsigned long v = value;
+    char tmp[33];
+    byte i = 0;
+    do {
+      tmp[i++] = digits[v % base];
+      v /= base;
+    } while (v > 0);
+    byte j = 0;
+    while (i > 0) {
+      str[j++] = tmp[--i];
+    }
+    str[j] = '\0';
+  }
+  return str;
+}
+
+char* itoa(int value, char* str, int base) {
+  return base == 10 ? ltoa(value, str, base) : ltoa((unsigned int)value, str, base);
+}
+
+size_t Print::write(const char* str) {
+  size_t n = 0;
+  while (*str) {
+    n += write((uint8_t)*str++);
+  }
+  return n;
+}
+
+size_t Print::print(const char* str) {
+  return write(str);
+}
+
+size_t Print::print(const __FlashStringHelper* str) {
+  return write(reinterpret_cast<const char*>(str));
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+  char str[34];
+  return write(ltoa(value, str, base));
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char str[34];
+  if (base == 10) {
+    sprintf(str, "%lu", value);
+  } else {
+    ltoa((long)value, str, base);
+  }
+  return write(str);
+}
+
+size_t Print::print(double value, int digits) {
+  char str[48];
+  snprintf(str, sizeof(str), "%.*f", digits, value);
+  return write(str);
+}
+
+size_t Print::println() {
+  return write('\r') + write('\n');
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (c != '\r') {
+    putchar(c);
+  }
+  return 1;
+}
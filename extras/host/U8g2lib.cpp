@@ -0,0 +1,154 @@
+/*
+  In-memory mock of U8g2 library for GEM library host harness (see include/U8g2lib.h).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <U8g2lib.h>
+
+const uint8_t u8g2_font_6x12_tr[1] = {6};
+const uint8_t u8g2_font_tom_thumb_4x6_tr[1] = {4};
+const uint8_t u8g2_font_6x12_t_cyrillic[1] = {6};
+const uint8_t u8g2_font_4x6_t_cyrillic[1] = {4};
+
+U8G2::U8G2(uint8_t bufferTileHeight)
+  : _tileHeight(bufferTileHeight)
+{
+  memset(buffer, 0, sizeof(buffer));
+  memset(display, 0, sizeof(display));
+}
+
+void U8G2::setPixel(int x, int y) {
+  int pageTop = _page * _tileHeight * 8;
+  if (x >= _clipX0 && x < _clipX1 && y >= _clipY0 && y < _clipY1 && x >= 0 && x < W && y >= pageTop && y < pageTop + _tileHeight * 8 && y < H) {
+    buffer[y][x] = _color == 2 ? !buffer[y][x] : _color;
+    pixels++;
+  }
+}
+
+void U8G2::clearPage() {
+  int pageTop = _page * _tileHeight * 8;
+  for (int y = pageTop; y < pageTop + _tileHeight * 8 && y < H; y++) {
+    memset(buffer[y], 0, W);
+  }
+}
+
+void U8G2::clear() {
+  ops++;
+  _page = 0;
+  memset(buffer, 0, sizeof(buffer));
+  memcpy(display, buffer, sizeof(buffer));
+  tiles += W / 8 * H / 8;
+}
+
+void U8G2::clearBuffer() {
+  clearPage();
+}
+
+void U8G2::sendBuffer() {
+  int pageTop = _page * _tileHeight * 8;
+  for (int y = pageTop; y < pageTop + _tileHeight * 8 && y < H; y++) {
+    memcpy(display[y], buffer[y], W);
+  }
+  tiles += W / 8 * _tileHeight;
+}
+
+void U8G2::firstPage() {
+  _page = 0;
+  clearPage();
+}
+
+uint8_t U8G2::nextPage() {
+  sendBuffer();
+  if ((_page + 1) * _tileHeight * 8 < H) {
+    _page++;
+    clearPage();
+    return 1;
+  }
+  _page = 0;
+  return 0;
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+  ops++;
+  for (int y = ty * 8; y < (ty + th) * 8 && y < H; y++) {
+    for (int x = tx * 8; x < (tx + tw) * 8 && x < W; x++) {
+      display[y][x] = buffer[y][x];
+    }
+  }
+  tiles += tw * th;
+}
+
+void U8G2::setClipWindow(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1) {
+  _clipX0 = x0;
+  _clipY0 = y0;
+  _clipX1 = x1;
+  _clipY1 = y1;
+}
+
+void U8G2::setMaxClipWindow() {
+  setClipWindow(0, 0, W, H);
+}
+
+void U8G2::drawPixel(u8g2_uint_t x, u8g2_uint_t y) {
+  ops++;
+  setPixel(x, y);
+}
+
+void U8G2::drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+  ops++;
+  for (int j = y; j < y + h; j++) {
+    for (int i = x; i < x + w; i++) {
+      setPixel(i, j);
+    }
+  }
+}
+
+void U8G2::drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+  ops++;
+  for (int i = x; i < x + w; i++) {
+    setPixel(i, y);
+    setPixel(i, y + h - 1);
+  }
+  for (int j = y + 1; j < y + h - 1; j++) {
+    setPixel(x, j);
+    setPixel(x + w - 1, j);
+  }
+}
+
+void U8G2::drawLine(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1) {
+  ops++;
+  int dx = (int)x1 - x0;
+  int dy = (int)y1 - y0;
+  int n = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+  for (int k = 0; k <= n; k++) {
+    setPixel(x0 + (n ? dx * k / n : 0), y0 + (n ? dy * k / n : 0));
+  }
+}
+
+void U8G2::drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t* bitmap) {
+  ops++;
+  int rowBytes = (w + 7) / 8;
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < w; i++) {
+      if (bitmap[j * rowBytes + i / 8] & (1 << (i & 7))) {
+        setPixel(x + i, y + j);
+      }
+    }
+  }
+}
+
+size_t U8G2::write(uint8_t c) {
+  ops++;
+  int w = _font != nullptr ? _font[0] : 6;
+  int h = w == 4 ? 6 : 8;
+  for (int j = 0; j < h - 1; j++) {
+    for (int i = 0; i < w - 1; i++) {
+      if ((c * 31 + i * 7 + j * 13) % 3 == 0) {
+        setPixel(_cursorX + i, _cursorY + j);
+      }
+    }
+  }
+  _cursorX += w;
+  return 1;
+}
@@ -0,0 +1,122 @@
+/*
+  Host benchmark of GEM library.
+
+  Builds the same menu as Example-07_Benchmark sketches do and runs the same operations on each of the versions
+  of GEM (AltSerialGraphicLCD, U8g2 with page and full buffer, Adafruit GFX), drawing on in-memory mocks
+  of the display libraries. For every operation average host time (in microseconds), number of draw calls
+  and amount of data sent to the display are printed: bytes of serial commands for AltSerialGraphicLCD,
+  bytes of transferred tiles for U8g2 and bytes of written pixels (16-bit color) for Adafruit GFX.
+
+  Host time is only good for comparing builds with each other on the same machine (e.g. regular build against
+  Advanced Mode), while counts of draw calls and of transferred data are the same as on the actual hardware
+  (within the accuracy of the mocks).
+
+  Usage: gem_benchmark [iterations]
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include "benchmark.h"
+
+int iterations = 200;
+
+// Variables of every type supported by GEM, editable through the short menu page
+int number = -512;
+byte level = 64;
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+float ratio = 3.141592;
+#endif
+char label[GEM_STR_LEN] = "Benchmark";
+bool enabled = true;
+byte tempo = 2;
+int speed = 100;
+
+SelectOptionByte selectTempoOptions[] = {{"Slow", 0}, {"Normal", 1}, {"Fast", 2}, {"Faster", 3}};
+GEMSelect selectTempo(sizeof(selectTempoOptions)/sizeof(SelectOptionByte), selectTempoOptions);
+
+#ifdef GEM_SUPPORT_SPINNER
+GEMSpinnerBoundariesInt spinnerSpeedBoundaries = { .step = 10, .min = 0, .max = 1000 };
+GEMSpinner spinnerSpeed(spinnerSpeedBoundaries);
+#endif
+
+void buttonAction() {}
+
+GEMItem menuItemInt("Number:", number);
+GEMItem menuItemByte("Level:", level);
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+GEMItem menuItemFloat("Ratio:", ratio);
+#endif
+GEMItem menuItemChar("Label:", label);
+GEMItem menuItemBool("Enabled:", enabled);
+GEMItem menuItemSelect("Tempo:", tempo, selectTempo);
+#ifdef GEM_SUPPORT_SPINNER
+GEMItem menuItemSpinner("Speed:", speed, spinnerSpeed);
+#endif
+GEMItem menuItemButton("Button", buttonAction);
+
+// Long menu page with 32 editable int items
+int longValues[32];
+GEMItem* longItems[32];
+char longTitles[32][GEM_STR_LEN];
+
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+// Menu page with six float items (formatting of their values takes most of the time spent drawing them)
+float floatValues[6] = {0.5, 1.25, -3.75, 10.125, 100.0625, -0.03125};
+GEMItem* floatItems[6];
+char floatTitles[6][GEM_STR_LEN];
+GEMPage menuPageFloat("Float Page");
+#endif
+
+GEMPage menuPageShort("Short Page");
+GEMPage menuPageLong("Long Page");
+GEMItem menuItemLinkLong("Long Page", menuPageLong);
+
+void setupMenu() {
+  menuPageShort.addMenuItem(menuItemInt);
+  menuPageShort.addMenuItem(menuItemByte);
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  menuPageShort.addMenuItem(menuItemFloat);
+  #endif
+  menuPageShort.addMenuItem(menuItemChar);
+  menuPageShort.addMenuItem(menuItemBool);
+  menuPageShort.addMenuItem(menuItemSelect);
+  #ifdef GEM_SUPPORT_SPINNER
+  menuPageShort.addMenuItem(menuItemSpinner);
+  #endif
+  menuPageShort.addMenuItem(menuItemButton);
+  menuPageShort.addMenuItem(menuItemLinkLong);
+
+  for (byte i = 0; i < 32; i++) {
+    snprintf(longTitles[i], GEM_STR_LEN, "Value %d:", i);
+    longItems[i] = new GEMItem(longTitles[i], longValues[i]);
+    menuPageLong.addMenuItem(*longItems[i]);
+  }
+  menuPageLong.setParentMenuPage(menuPageShort);
+
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  for (byte i = 0; i < 6; i++) {
+    snprintf(floatTitles[i], GEM_STR_LEN, "Float %d:", i);
+    floatItems[i] = new GEMItem(floatTitles[i], floatValues[i]);
+    menuPageFloat.addMenuItem(*floatItems[i]);
+  }
+  #endif
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    iterations = atoi(argv[1]) > 0 ? atoi(argv[1]) : 1;
+  }
+  setupMenu();
+
+  #if defined(GEM_ENABLE_ADVANCED_MODE) && defined(GEM_ENABLE_STATIC_DRAW)
+  printf("GEM host benchmark, Advanced Mode (static draw), %d iterations\n", iterations);
+  #elif defined(GEM_ENABLE_ADVANCED_MODE)
+  printf("GEM host benchmark, Advanced Mode (virtual), %d iterations\n", iterations);
+  #else
+  printf("GEM host benchmark, regular, %d iterations\n", iterations);
+  #endif
+  benchmarkGLCD();
+  benchmarkU8g2();
+  benchmarkAdafruitGFX();
+  return 0;
+}
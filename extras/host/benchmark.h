@@ -0,0 +1,100 @@
+/*
+  Host benchmark of GEM library (see benchmark.cpp).
+
+  Menu shared by all of the versions of GEM and operations that are measured on each of them. Since versions
+  of GEM can't be included in the same translation unit, each of them is benchmarked in its own source file,
+  which should include header of its version of GEM prior to this file.
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#ifndef HEADER_GEM_HOST_BENCHMARK
+#define HEADER_GEM_HOST_BENCHMARK
+
+#include <stdio.h>
+#include <GEMItem.h>
+#include <GEMPage.h>
+#include <GEMSelect.h>
+#include <GEMSpinner.h>
+
+// Number of times each of the operations is repeated (result is averaged)
+extern int iterations;
+
+extern GEMPage menuPageShort;
+extern GEMPage menuPageLong;
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+extern GEMPage menuPageFloat;
+#endif
+
+void benchmarkGLCD();
+void benchmarkU8g2();
+void benchmarkAdafruitGFX();
+
+#ifdef GEM_KEY_OK
+
+// Print average time, draw calls and sent bytes of the operation, called iterations times with the number of iteration
+template <class Display, class Operation>
+void measure(const char* name, Display& display, Operation operation) {
+  display.resetCounters();
+  unsigned long start = micros();
+  for (int i = 0; i < iterations; i++) {
+    operation(i);
+  }
+  unsigned long elapsed = micros() - start;
+  printf("  %-14s %10.2f %10.1f %10.1f\n", name, (double)elapsed / iterations, (double)drawCalls(display) / iterations, (double)sentBytes(display) / iterations);
+}
+
+// Move menu pointer to the menu item with supplied index on the page and draw menu
+template <class Menu>
+void selectMenuItem(Menu& menu, GEMPage& page, byte index) {
+  menu.setMenuPageCurrent(page);
+  page.setCurrentMenuItemIndex(index);
+  menu.drawMenu();
+}
+
+// Time edit mode of the menu item with supplied index of the short page: each iteration changes value once
+template <class Menu, class Display>
+void measureEdit(const char* name, Menu& menu, Display& display, byte index) {
+  selectMenuItem(menu, menuPageShort, index);
+  menu.registerKeyPress(GEM_KEY_OK);
+  measure(name, display, [&](int) { menu.registerKeyPress(GEM_KEY_UP); });
+  menu.registerKeyPress(GEM_KEY_CANCEL);
+}
+
+template <class Menu, class Display>
+void runBenchmark(const char* name, Menu& menu, Display& display) {
+  printf("%s\n", name);
+  printf("  %-14s %10s %10s %10s\n", "operation", "us", "calls", "bytes");
+  menu.setSplashDelay(0);
+  menu.init();
+
+  selectMenuItem(menu, menuPageShort, 0);
+  measure("short page", display, [&](int) { menu.drawMenu(); });
+  selectMenuItem(menu, menuPageLong, 0);
+  measure("long page", display, [&](int) { menu.drawMenu(); });
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  selectMenuItem(menu, menuPageFloat, 0);
+  measure("float page", display, [&](int) { menu.drawMenu(); });
+  #endif
+
+  // Each key press results in menu pointer moving to the next (or previous) menu item
+  selectMenuItem(menu, menuPageLong, 0);
+  measure("navigate", display, [&](int i) { menu.registerKeyPress((i / 31) % 2 ? GEM_KEY_UP : GEM_KEY_DOWN); });
+
+  byte index = 0;
+  measureEdit("edit int", menu, display, index++);
+  index++; // byte
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  measureEdit("edit float", menu, display, index++);
+  #endif
+  measureEdit("edit char[]", menu, display, index++);
+  index++; // bool
+  measureEdit("edit select", menu, display, index++);
+  #ifdef GEM_SUPPORT_SPINNER
+  measureEdit("edit spinner", menu, display, index++);
+  #endif
+}
+
+#endif
+
+#endif
@@ -0,0 +1,20 @@
+/*
+  Host benchmark of GEM library: Adafruit GFX version of GEM (see benchmark.cpp).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <GEM_adafruit_gfx.h>
+
+// Draw calls and bytes of pixels (16-bit color) sent to the display so far
+unsigned long drawCalls(Adafruit_GFX& agfx) { return agfx.ops; }
+unsigned long sentBytes(Adafruit_GFX& agfx) { return agfx.pixels * 2; }
+
+#include "benchmark.h"
+
+Adafruit_GFX agfx;
+GEM_adafruit_gfx menuAGFX(agfx, GEM_POINTER_ROW, GEM_ITEMS_COUNT_AUTO);
+
+void benchmarkAdafruitGFX() {
+  runBenchmark("Adafruit GFX", menuAGFX, agfx);
+}
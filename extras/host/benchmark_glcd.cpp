@@ -0,0 +1,20 @@
+/*
+  Host benchmark of GEM library: AltSerialGraphicLCD version of GEM (see benchmark.cpp).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <GEM.h>
+
+// Draw calls and bytes of serial commands sent to the display so far
+unsigned long drawCalls(GLCD& glcd) { return glcd.ops; }
+unsigned long sentBytes(GLCD& glcd) { return glcd.bytes; }
+
+#include "benchmark.h"
+
+GLCD glcd;
+GEM menuGLCD(glcd, GEM_POINTER_ROW, GEM_ITEMS_COUNT_AUTO);
+
+void benchmarkGLCD() {
+  runBenchmark("AltSerialGraphicLCD", menuGLCD, glcd);
+}
@@ -0,0 +1,24 @@
+/*
+  Host benchmark of GEM library: U8g2 version of GEM, with page buffer and with full buffer (see benchmark.cpp).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <GEM_u8g2.h>
+
+// Draw calls and bytes of tiles sent to the display so far
+unsigned long drawCalls(U8G2& u8g2) { return u8g2.ops; }
+unsigned long sentBytes(U8G2& u8g2) { return u8g2.tiles * 8; }
+
+#include "benchmark.h"
+
+U8G2 u8g2Page(1);
+GEM_u8g2 menuU8g2Page(u8g2Page, GEM_POINTER_ROW, GEM_ITEMS_COUNT_AUTO);
+
+U8G2 u8g2Full;
+GEM_u8g2 menuU8g2Full(u8g2Full, GEM_POINTER_ROW, GEM_ITEMS_COUNT_AUTO);
+
+void benchmarkU8g2() {
+  runBenchmark("U8g2 (page buffer)", menuU8g2Page, u8g2Page);
+  runBenchmark("U8g2 (full buffer)", menuU8g2Full, u8g2Full);
+}
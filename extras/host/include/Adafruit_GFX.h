@@ -0,0 +1,74 @@
+/*
+  In-memory mock of Adafruit GFX library (https://github.com/adafruit/Adafruit-GFX-Library) for GEM library host harness.
+
+  Implements the subset of Adafruit_GFX class that GEM_adafruit_gfx uses, drawing into 16-bit color framebuffer
+  ('frame' array) that plays the role of the display memory. Text printed with GFX fonts (e.g. the ones supplied
+  with GEM) is rendered with the actual glyphs of the font; glyphs of the built-in font are replaced with
+  deterministic patterns of the size of the font cell.
+
+  Counters (reset with resetCounters()):
+  - 'ops' - number of draw calls;
+  - 'pixels' - number of pixels written to the display.
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#ifndef HEADER_GEM_HOST_ADAFRUIT_GFX
+#define HEADER_GEM_HOST_ADAFRUIT_GFX
+
+#include <Arduino.h>
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print {
+  public:
+    enum { W = 160, H = 128 };
+    Adafruit_GFX();
+    int16_t width() { return W; }
+    int16_t height() { return H; }
+
+    void fillScreen(uint16_t color);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+
+    void setFont(const GFXfont* font = nullptr) { _font = font; }
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    void setTextColor(uint16_t color) { _textColor = _textBackground = color; }
+    void setTextColor(uint16_t color, uint16_t bg) { _textColor = color; _textBackground = bg; }
+    void setTextSize(uint8_t size) { _textSize = size > 0 ? size : 1; }
+    void setTextWrap(bool) {}
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void resetCounters() { ops = pixels = 0; }
+
+    uint16_t frame[H][W];
+    unsigned long ops = 0;
+    unsigned long pixels = 0;
+  private:
+    void setPixel(int x, int y, uint16_t color);
+    const GFXfont* _font = nullptr;
+    int16_t _cursorX = 0, _cursorY = 0;
+    uint16_t _textColor = 0xFFFF, _textBackground = 0xFFFF;
+    uint8_t _textSize = 1;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+  In-memory mock of AltSerialGraphicLCD library (http://www.jasspa.com/serialGLCD.html) for GEM library host harness.
+
+  Implements the subset of GLCD class that GEM uses, drawing into monochrome framebuffer ('frame' array)
+  that plays the role of the memory of the SparkFun Graphic LCD Serial Backpack. Glyphs are not the real
+  glyphs of the font: each character is rendered as a deterministic pattern of the size of the font cell.
+
+  Counters (reset with resetCounters()):
+  - 'ops' - number of commands;
+  - 'bytes' - number of bytes the commands take on the serial line (approximate), which is what time
+    of drawing on the actual backpack is mostly defined by.
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#ifndef HEADER_GEM_HOST_ALTSERIALGRAPHICLCD
+#define HEADER_GEM_HOST_ALTSERIALGRAPHICLCD
+
+#include <Arduino.h>
+
+#define GLCD_MODE_REVERSE 0
+#define GLCD_MODE_NORMAL 1
+#define GLCD_MODE_XOR 2
+
+#define GLCD_ID_CRLF 1
+#define GLCD_ID_SCROLL 2
+
+class SoftwareSerial {
+  public:
+    SoftwareSerial(uint8_t, uint8_t) {}
+    void begin(long) {}
+};
+
+class GLCD {
+  public:
+    enum { W = 128, H = 64, SPRITES = 8 };
+    GLCD();
+    explicit GLCD(SoftwareSerial&) : GLCD() {}
+    void reset() {}
+
+    void clearScreen();
+    void drawMode(uint8_t mode) { _drawMode = mode; bytes += 3; }
+    void fontMode(uint8_t mode) { _fontMode = mode; bytes += 3; }
+    void fontFace(uint8_t face) { _fontFace = face; bytes += 3; }
+    void set(uint8_t, uint8_t) { bytes += 4; }
+    void setX(uint8_t x) { _x = x; bytes += 3; }
+    void setY(uint8_t y) { _y = y; bytes += 3; }
+    void setXY(uint8_t x, uint8_t y) { _x = x; _y = y; bytes += 4; }
+
+    void drawPixel(uint8_t x, uint8_t y, uint8_t mode);
+    void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode);
+    void drawBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode);
+    void fillBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t fill = 0xFF);
+    void eraseBox(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+    void bitblt_P(uint8_t x, uint8_t y, uint8_t mode, const uint8_t* data);
+    void loadSprite_P(uint8_t id, const uint8_t* data);
+    void drawSprite(uint8_t x, uint8_t y, uint8_t id, uint8_t mode);
+    void put(char c);
+    void putstr(char* str);
+
+    void resetCounters() { ops = bytes = 0; }
+
+    uint8_t xdim = W;
+    uint8_t ydim = H;
+    uint8_t frame[H][W];
+    unsigned long ops = 0;
+    unsigned long bytes = 0;
+  private:
+    void setPixel(int x, int y, bool on, uint8_t mode);
+    void blit(uint8_t x, uint8_t y, uint8_t mode, const uint8_t* data);
+    const uint8_t* _sprites[SPRITES] = {};
+    uint8_t _x = 0, _y = 0;
+    uint8_t _drawMode = GLCD_MODE_NORMAL;
+    uint8_t _fontMode = GLCD_MODE_NORMAL;
+    uint8_t _fontFace = 0;
+};
+
+#endif
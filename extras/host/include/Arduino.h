@@ -0,0 +1,84 @@
+/*
+  Minimal Arduino core for building GEM library on a desktop host (see "Host build" section of README.md).
+
+  Provides only those parts of the Arduino API that are used by GEM and by the display mocks
+  of this directory. Program memory is ordinary memory on the host, and time is the monotonic
+  clock of the host offset by the total of delay() calls (delay() itself doesn't block).
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#ifndef HEADER_GEM_HOST_ARDUINO
+#define HEADER_GEM_HOST_ARDUINO
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Program memory
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+// Interrupts
+#define noInterrupts()
+#define interrupts()
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// AVR libc conversions
+char* dtostrf(double val, signed char width, unsigned char prec, char* sout);
+char* itoa(int value, char* str, int base);
+char* ltoa(long value, char* str, int base);
+
+// Base class of the character output devices (Serial and displays)
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const char* str);
+    size_t print(const char* str);
+    size_t print(const __FlashStringHelper* str);
+    size_t print(char c);
+    size_t print(int value, int base = 10);
+    size_t print(unsigned int value, int base = 10);
+    size_t print(long value, int base = 10);
+    size_t print(unsigned long value, int base = 10);
+    size_t print(double value, int digits = 2);
+    size_t println();
+    template <typename T>
+    size_t println(T value) { size_t n = print(value); return n + println(); }
+};
+
+// Serial port, prints to standard output
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,101 @@
+/*
+  In-memory mock of U8g2 library (https://github.com/olikraus/U8g2_Arduino) for GEM library host harness.
+
+  Implements the subset of U8G2 class that GEM_u8g2 uses, drawing into a monochrome framebuffer.
+  Buffer is transferred to the "display" ('display' array) in the same way the real library does it:
+  page by page in firstPage()/nextPage() loop, as a whole in sendBuffer(), or partially in updateDisplayArea().
+  Glyphs are not the real glyphs of the font: each character is rendered as a deterministic pattern
+  of the size of the font cell, which is enough to compare frames drawn in different ways.
+
+  Counters (reset with resetCounters()):
+  - 'ops' - number of draw calls;
+  - 'pixels' - number of pixels written to the buffer;
+  - 'tiles' - number of 8x8 tiles transferred to the display.
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#ifndef HEADER_GEM_HOST_U8G2LIB
+#define HEADER_GEM_HOST_U8G2LIB
+
+#include <Arduino.h>
+
+typedef uint16_t u8g2_uint_t;
+
+#define U8X8_PROGMEM
+#define U8G2_R0 0
+#define U8X8_PIN_NONE 255
+
+// Key codes returned by getMenuEvent()
+#define U8X8_MSG_GPIO_MENU_SELECT 80
+#define U8X8_MSG_GPIO_MENU_NEXT 81
+#define U8X8_MSG_GPIO_MENU_PREV 82
+#define U8X8_MSG_GPIO_MENU_HOME 83
+#define U8X8_MSG_GPIO_MENU_UP 84
+#define U8X8_MSG_GPIO_MENU_DOWN 85
+
+// Fonts used by GEM_u8g2 (only their identity matters to the mock)
+extern const uint8_t u8g2_font_6x12_tr[];
+extern const uint8_t u8g2_font_tom_thumb_4x6_tr[];
+extern const uint8_t u8g2_font_6x12_t_cyrillic[];
+extern const uint8_t u8g2_font_4x6_t_cyrillic[];
+
+class U8G2 : public Print {
+  public:
+    enum { W = 128, H = 64 };
+    /*
+      @param 'bufferTileHeight' - height of the buffer in tiles: 1 for page buffer (_1 constructors of U8g2),
+      H / 8 for full buffer (_F constructors)
+    */
+    U8G2(uint8_t bufferTileHeight = H / 8);
+    void begin() {}
+    void initDisplay() {}
+    void setPowerSave(uint8_t) {}
+    void enableUTF8Print() {}
+    void disableUTF8Print() {}
+    u8g2_uint_t getDisplayWidth() { return W; }
+    u8g2_uint_t getDisplayHeight() { return H; }
+    uint8_t getBufferTileHeight() { return _tileHeight; }
+    uint8_t getBufferTileWidth() { return W / 8; }
+
+    void clear();
+    void clearBuffer();
+    void sendBuffer();
+    void firstPage();
+    uint8_t nextPage();
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+
+    void setDrawColor(uint8_t color) { _color = color; }
+    void setClipWindow(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1);
+    void setMaxClipWindow();
+    void drawPixel(u8g2_uint_t x, u8g2_uint_t y);
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+    void drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+    void drawLine(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1);
+    void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t* bitmap);
+
+    void setFont(const uint8_t* font) { _font = font; }
+    void setFontPosTop() {}
+    void setCursor(u8g2_uint_t x, u8g2_uint_t y) { _cursorX = x; _cursorY = y; }
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void resetCounters() { ops = pixels = tiles = 0; }
+
+    uint8_t buffer[H][W];
+    uint8_t display[H][W];
+    unsigned long ops = 0;
+    unsigned long pixels = 0;
+    unsigned long tiles = 0;
+  private:
+    void setPixel(int x, int y);
+    void clearPage();
+    uint8_t _tileHeight;
+    uint8_t _page = 0;
+    uint8_t _color = 1;
+    int _clipX0 = 0, _clipY0 = 0, _clipX1 = W, _clipY1 = H;
+    int _cursorX = 0, _cursorY = 0;
+    const uint8_t* _font = nullptr;
+};
+
+#endif
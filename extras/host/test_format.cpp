@@ -0,0 +1,196 @@
+/*
+  Host tests of GEMFormat: formatting and parsing of fixed-point and floating-point values.
+
+  Covers sign, rounding, precision limit (GEM_FORMAT_MAX_PREC) and overflow edge cases of formatFixed(),
+  parseFixed(), formatFloat() and parseFloat(). Floating-point results are compared against the standard
+  library (dtostrf() of the host is printf-based, atof() is correctly rounded).
+
+  Usage: gem_test_format (exit code is the number of failed checks)
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <stdio.h>
+#include <constants.h>
+#include <GEMFormat.h>
+
+static int failures = 0;
+
+static void checkString(const char* expression, const char* actual, const char* expected) {
+  if (strcmp(actual, expected) != 0) {
+    printf("FAIL %s: \"%s\", expected \"%s\"\n", expression, actual, expected);
+    failures++;
+  }
+}
+
+static void checkInt(const char* expression, long actual, long expected) {
+  if (actual != expected) {
+    printf("FAIL %s: %ld, expected %ld\n", expression, actual, expected);
+    failures++;
+  }
+}
+
+static void checkDouble(const char* expression, double actual, double expected) {
+  if (actual != expected) {
+    printf("FAIL %s: %.17g, expected %.17g\n", expression, actual, expected);
+    failures++;
+  }
+}
+
+static char str[GEM_STR_LEN * 2];
+
+#define CHECK_FORMAT_FIXED(value, precision, expected) checkString("formatFixed(" #value ", " #precision ")", GEMFormat::formatFixed(value, precision, str), expected)
+#define CHECK_PARSE_FIXED(string, precision, expected) checkInt("parseFixed(\"" string "\", " #precision ")", GEMFormat::parseFixed(string, precision), expected)
+
+static void testFormatFixed() {
+  CHECK_FORMAT_FIXED(2150, 2, "21.50");
+  CHECK_FORMAT_FIXED(-2150, 2, "-21.50");
+  CHECK_FORMAT_FIXED(0, 0, "0");
+  CHECK_FORMAT_FIXED(0, 3, "0.000");
+  CHECK_FORMAT_FIXED(7, 0, "7");
+  CHECK_FORMAT_FIXED(-7, 0, "-7");
+  // Leading zeros of fractional part, sign of values with zero integer part
+  CHECK_FORMAT_FIXED(5, 2, "0.05");
+  CHECK_FORMAT_FIXED(-5, 2, "-0.05");
+  CHECK_FORMAT_FIXED(-100, 2, "-1.00");
+  // Limits of int32_t
+  CHECK_FORMAT_FIXED(2147483647L, 0, "2147483647");
+  CHECK_FORMAT_FIXED((-2147483647L - 1), 0, "-2147483648");
+  CHECK_FORMAT_FIXED(2147483647L, 9, "2.147483647");
+  CHECK_FORMAT_FIXED((-2147483647L - 1), 9, "-2.147483648");
+  // Precision is limited to GEM_FORMAT_MAX_PREC
+  CHECK_FORMAT_FIXED(123, 12, "0.000000123");
+}
+
+static void testParseFixed() {
+  CHECK_PARSE_FIXED("21.5", 2, 2150);
+  CHECK_PARSE_FIXED("21.50", 2, 2150);
+  CHECK_PARSE_FIXED("21", 2, 2100);
+  CHECK_PARSE_FIXED(".5", 2, 50);
+  CHECK_PARSE_FIXED("-0.05", 2, -5);
+  CHECK_PARSE_FIXED("+3.14", 2, 314);
+  CHECK_PARSE_FIXED("  3.14", 2, 314);
+  CHECK_PARSE_FIXED("-21.50", 0, -22);
+  CHECK_PARSE_FIXED("", 2, 0);
+  CHECK_PARSE_FIXED("-", 2, 0);
+  CHECK_PARSE_FIXED("abc", 2, 0);
+  CHECK_PARSE_FIXED("1.5abc", 1, 15);
+  // Digits beyond precision: the first of them rounds half away from zero, the rest are ignored
+  CHECK_PARSE_FIXED("2.344", 2, 234);
+  CHECK_PARSE_FIXED("2.345", 2, 235);
+  CHECK_PARSE_FIXED("-2.345", 2, -235);
+  CHECK_PARSE_FIXED("2.3449", 2, 234);
+  CHECK_PARSE_FIXED("9.995", 2, 1000);
+  CHECK_PARSE_FIXED("-9.995", 2, -1000);
+  CHECK_PARSE_FIXED("0.5", 0, 1);
+  // Precision is limited to GEM_FORMAT_MAX_PREC
+  CHECK_PARSE_FIXED("1.23", 12, 1230000000L);
+  CHECK_PARSE_FIXED("0.0000000015", 12, 2);
+  // Values out of range of int32_t are saturated
+  CHECK_PARSE_FIXED("2147483647", 0, 2147483647L);
+  CHECK_PARSE_FIXED("2147483648", 0, 2147483647L);
+  CHECK_PARSE_FIXED("-2147483648", 0, (-2147483647L - 1));
+  CHECK_PARSE_FIXED("-2147483649", 0, (-2147483647L - 1));
+  CHECK_PARSE_FIXED("99999999999999999999", 0, 2147483647L);
+  CHECK_PARSE_FIXED("-99999999999999999999", 0, (-2147483647L - 1));
+  CHECK_PARSE_FIXED("21474836.47", 2, 2147483647L);
+  CHECK_PARSE_FIXED("21474836.48", 2, 2147483647L);
+  CHECK_PARSE_FIXED("21474836.465", 2, 2147483647L);
+  CHECK_PARSE_FIXED("21474836.475", 2, 2147483647L);
+  CHECK_PARSE_FIXED("-21474836.48", 2, (-2147483647L - 1));
+  CHECK_PARSE_FIXED("-21474836.49", 2, (-2147483647L - 1));
+  CHECK_PARSE_FIXED("3", 9, 2147483647L);
+  // Formatted values are parsed back to the same value
+  const int32_t values[] = {0, 1, -1, 99, -99, 100, 123456, -654321, 2147483647L, (-2147483647L - 1)};
+  for (byte precision = 0; precision <= GEM_FORMAT_MAX_PREC; precision++) {
+    for (byte i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+      checkInt("parseFixed(formatFixed())", GEMFormat::parseFixed(GEMFormat::formatFixed(values[i], precision, str), precision), values[i]);
+    }
+  }
+}
+
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+
+#define CHECK_FORMAT_FLOAT(value, precision, expected) checkString("formatFloat(" #value ", " #precision ")", GEMFormat::formatFloat(value, precision, str), expected)
+#define CHECK_PARSE_FLOAT(string) checkDouble("parseFloat(\"" string "\")", GEMFormat::parseFloat(string), atof(string))
+
+static void testFormatFloat() {
+  CHECK_FORMAT_FLOAT(3.141592, 6, "3.141592");
+  CHECK_FORMAT_FLOAT(-3.141592, 3, "-3.142");
+  CHECK_FORMAT_FLOAT(0.0, 2, "0.00");
+  CHECK_FORMAT_FLOAT(12.0, 0, "12");
+  CHECK_FORMAT_FLOAT(-0.03125, 3, "-0.031");
+  CHECK_FORMAT_FLOAT(100.0625, 2, "100.06");
+  // Sign is kept for negative values that round to zero (same as dtostrf())
+  CHECK_FORMAT_FLOAT(-0.001, 2, "-0.00");
+  // Rounding carries over into integer part
+  CHECK_FORMAT_FLOAT(9.9996, 3, "10.000");
+  CHECK_FORMAT_FLOAT(-9.9996, 3, "-10.000");
+  CHECK_FORMAT_FLOAT(0.96, 0, "1");
+  CHECK_FORMAT_FLOAT(4294967294.9999, 2, "4294967295.00");
+  // Largest values handled with integer arithmetic
+  CHECK_FORMAT_FLOAT(4294967294.0, 0, "4294967294");
+  CHECK_FORMAT_FLOAT(-4294967294.0, 1, "-4294967294.0");
+  // Precision beyond GEM_FORMAT_MAX_PREC and values that don't fit into 32-bit integer are left to dtostrf()
+  char expected[48];
+  CHECK_FORMAT_FLOAT(1.5, 10, dtostrf(1.5, 11, 10, expected));
+  CHECK_FORMAT_FLOAT(4294967295.0, 2, dtostrf(4294967295.0, 3, 2, expected));
+  CHECK_FORMAT_FLOAT(5e9, 1, dtostrf(5e9, 2, 1, expected));
+  CHECK_FORMAT_FLOAT(-5e9, 1, dtostrf(-5e9, 2, 1, expected));
+  CHECK_FORMAT_FLOAT(NAN, 2, dtostrf(NAN, 3, 2, expected));
+  // Formatted values are within half of the last digit from the original value
+  const double values[] = {0.5, 1.25, -3.75, 10.125, 100.0625, -0.03125, 3.141592, -2.718281828, 12345.678, -98765.4321};
+  for (byte precision = 0; precision <= 6; precision++) {
+    for (byte i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+      double error = fabs(atof(GEMFormat::formatFloat(values[i], precision, str)) - values[i]);
+      if (error > 0.5000001 / pow(10, precision)) {
+        printf("FAIL formatFloat(%.10g, %d): \"%s\"\n", values[i], precision, str);
+        failures++;
+      }
+    }
+  }
+}
+
+static void testParseFloat() {
+  // Results are the same as of atof()
+  CHECK_PARSE_FLOAT("3.141592");
+  CHECK_PARSE_FLOAT("-3.141592");
+  CHECK_PARSE_FLOAT("+12.5");
+  CHECK_PARSE_FLOAT("  -0.05");
+  CHECK_PARSE_FLOAT("0");
+  CHECK_PARSE_FLOAT("-0.000");
+  CHECK_PARSE_FLOAT(".25");
+  CHECK_PARSE_FLOAT("7.");
+  CHECK_PARSE_FLOAT("");
+  CHECK_PARSE_FLOAT("-");
+  CHECK_PARSE_FLOAT("12abc");
+  CHECK_PARSE_FLOAT("1.2.3");
+  CHECK_PARSE_FLOAT("000000000012.5");
+  // Up to 9 significant digits and up to GEM_FORMAT_MAX_PREC fractional digits are accumulated in 32-bit integer
+  CHECK_PARSE_FLOAT("123456789");
+  CHECK_PARSE_FLOAT("-12345.6789");
+  CHECK_PARSE_FLOAT("0.000000001");
+  CHECK_PARSE_FLOAT("999999999");
+  // Longer strings and exponent notation are left to atof()
+  CHECK_PARSE_FLOAT("1234567890");
+  CHECK_PARSE_FLOAT("-4294967296.5");
+  CHECK_PARSE_FLOAT("0.0000000001");
+  CHECK_PARSE_FLOAT("3.14159265358979");
+  CHECK_PARSE_FLOAT("1e3");
+  CHECK_PARSE_FLOAT("-2.5E-3");
+}
+
+#endif
+
+int main() {
+  testFormatFixed();
+  testParseFixed();
+  #ifdef GEM_SUPPORT_FLOAT_EDIT
+  testFormatFloat();
+  testParseFloat();
+  #endif
+  if (failures == 0) {
+    printf("All checks passed\n");
+  }
+  return failures;
+}
@@ -0,0 +1,397 @@
+/*
+  Host tests of menu pages and menu objects: menu pages backed by items provider, drawn by U8g2 version of GEM.
+
+  Covers lookups of materialized provider items (which should not call fill callback again), stepping through
+  provider items after lookup of a distant one, drawing of the whole screen of provider items in edit mode,
+  accelerated edit of digits of numeric variables, lookups of options of select shared by several menu items, and
+  the first frame drawn after the controller of the menu object is replaced.
+  Built in Advanced Mode as well (gem_test_menu_advanced), where it also checks that navigation and edit methods
+  overridden in a class derived from GEMController are called on key presses, and with refreshing of changed values
+  enabled (gem_test_menu_refresh), where it also checks that changes of values that fit into 32 bits are always detected.
+
+  Usage: gem_test_menu (exit code is the number of failed checks)
+
+  This file is part of GEM library host harness and is not the part of the library itself.
+*/
+
+#include <stdio.h>
+#include <GEM_u8g2.h>
+
+static int failures = 0;
+
+static void checkInt(const char* expression, long actual, long expected) {
+  if (actual != expected) {
+    printf("FAIL %s: %ld, expected %ld\n", expression, actual, expected);
+    failures++;
+  }
+}
+
+#define CHECK_INT(actual, expected) checkInt(#actual, (actual), (expected))
+
+// Items provider: 100 menu items, ring of 6 scratch menu items, every call of fill callback is logged
+
+static const GEMIndex PROVIDER_COUNT = 100;
+static const byte PROVIDER_RING_LENGTH = 6;
+
+static char providerTitles[PROVIDER_COUNT][GEM_STR_LEN];
+static int providerValue = 0;
+static GEMItem providerItems[PROVIDER_RING_LENGTH] = {{"", providerValue}, {"", providerValue}, {"", providerValue}, {"", providerValue}, {"", providerValue}, {"", providerValue}};
+
+static GEMIndex fillLog[64];
+static byte fillLogLength = 0;
+
+static GEMIndex countProviderItems() {
+  return PROVIDER_COUNT;
+}
+
+static void fillProviderItem(GEMItem& menuItem, GEMIndex index) {
+  if (fillLogLength < sizeof(fillLog) / sizeof(fillLog[0])) {
+    fillLog[fillLogLength] = index;
+  }
+  fillLogLength++;
+  menuItem.setTitle(providerTitles[index]);
+}
+
+static void printFillLog() {
+  printf("     fill log:");
+  for (byte i = 0; i < fillLogLength && i < sizeof(fillLog) / sizeof(fillLog[0]); i++) {
+    printf(" fill(%d)", (int)fillLog[i]);
+  }
+  printf("\n");
+}
+
+static void checkFillLog(const char* expression, const GEMIndex* expected, byte expectedLength) {
+  bool match = fillLogLength == expectedLength;
+  for (byte i = 0; match && i < expectedLength; i++) {
+    match = fillLog[i] == expected[i];
+  }
+  if (!match) {
+    printf("FAIL %s\n", expression);
+    printFillLog();
+    failures++;
+  }
+}
+
+// Menu page with lookups of menu items used by GEM exposed to the tests
+class TestPage : public GEMPage {
+  public:
+    using GEMPage::GEMPage;
+    using GEMPage::getMenuItemNum;
+    using GEMPage::getMenuItemNext;
+};
+
+// Lookups of provider items on the menu page itself
+
+static void testProviderLookups() {
+  TestPage page("Provider");
+  page.setItemsProvider(providerItems, PROVIDER_RING_LENGTH, countProviderItems, fillProviderItem);
+  fillLogLength = 0;
+
+  CHECK_INT(page.getItemsCount(), PROVIDER_COUNT);
+
+  GEMItem* third = page.getMenuItem(3);
+  GEMItem* first = page.getMenuItem(0);
+  static const GEMIndex filled[] = {3, 0};
+  checkFillLog("getMenuItem(3), getMenuItem(0) fill both menu items", filled, 2);
+
+  // Looking up the menu items that are already materialized calls no fill callback, and keeps both of them
+  CHECK_INT(page.getMenuItem(3) == third, true);
+  CHECK_INT(page.getMenuItem(0) == first, true);
+  CHECK_INT(page.getMenuItemNum(*third, true), 3);
+  CHECK_INT(page.getMenuItemNum(*first, true), 0);
+  checkFillLog("repeated lookups of materialized menu items call no fill callback", filled, 2);
+
+  // Stepping from provider item relies on the index stored in its slot, even after lookup of a distant item
+  GEMItem* distant = page.getMenuItem(50);
+  CHECK_INT(page.getMenuItemNum(*distant, true), 50);
+  GEMItem* fourth = page.getMenuItemNext(*third);
+  CHECK_INT(fourth != nullptr, true);
+  if (fourth != nullptr) {
+    CHECK_INT(page.getMenuItemNum(*fourth, true), 4);
+  }
+  CHECK_INT(page.getMenuItemNum(*third, true), 3);
+
+  // The last provider item is followed by nothing
+  GEMItem* last = page.getMenuItem(PROVIDER_COUNT - 1);
+  CHECK_INT(page.getMenuItemNext(*last) == nullptr, true);
+  CHECK_INT(page.getMenuItem(PROVIDER_COUNT) == nullptr, true);
+
+  // Refreshed page materializes menu items anew
+  page.refreshItems();
+  fillLogLength = 0;
+  page.getMenuItem(3);
+  static const GEMIndex refilled[] = {3};
+  checkFillLog("getMenuItem(3) after refreshItems() fills menu item anew", refilled, 1);
+}
+
+// Drawing of the screen of provider items while one of them is edited
+
+static U8G2 u8g2;
+
+// Any pixel set in the row of menu items with the supplied index on screen
+static bool isRowDrawn(byte row) {
+  for (byte y = 10 + row * 10; y < 20 + row * 10; y++) {
+    for (byte x = 0; x < U8G2::W; x++) {
+      if (u8g2.display[y][x]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static void testProviderEditDraw() {
+  GEMPage page("Provider");
+  page.setItemsProvider(providerItems, PROVIDER_RING_LENGTH, countProviderItems, fillProviderItem);
+  GEM_u8g2 menu(u8g2, GEM_POINTER_ROW, 5);
+  menu.setSplashDelay(0);
+  menu.init();
+  menu.setMenuPageCurrent(page);
+  menu.drawMenu();
+  for (byte i = 0; i < 3; i++) {
+    menu.registerKeyPress(GEM_KEY_DOWN);
+  }
+  menu.registerKeyPress(GEM_KEY_OK);
+  CHECK_INT(menu.isEditMode(), true);
+  CHECK_INT(page.getCurrentMenuItemIndex(), 3);
+
+  page.refreshItems();
+  fillLogLength = 0;
+  u8g2.clear();
+  menu.drawMenu();
+
+  for (byte row = 0; row < 5; row++) {
+    if (!isRowDrawn(row)) {
+      printf("FAIL row %d of provider items is not drawn in edit mode\n", (int)row);
+      failures++;
+    }
+  }
+  for (byte i = 0; i < fillLogLength && i < sizeof(fillLog) / sizeof(fillLog[0]); i++) {
+    for (byte j = 0; j < i; j++) {
+      if (fillLog[i] == fillLog[j]) {
+        printf("FAIL drawMenu() in edit mode fills menu item %d more than once\n", (int)fillLog[i]);
+        printFillLog();
+        failures++;
+      }
+    }
+  }
+}
+
+// Accelerated edit of digits (key presses of the test follow each other well within the interval of the rapid series)
+
+static void testDigitAcceleration() {
+  int number = 0;
+  GEMItem menuItemNumber("Number", number);
+  GEMPage page("Digits");
+  page.addMenuItem(menuItemNumber);
+  GEM_u8g2 menu(u8g2, GEM_POINTER_ROW, 5);
+  menu.setSplashDelay(0);
+  menu.setDigitAcceleration(150, 2, 3, 1);
+  menu.init();
+  menu.setMenuPageCurrent(page);
+  menu.drawMenu();
+  menu.registerKeyPress(GEM_KEY_OK);
+  CHECK_INT(menu.isEditMode(), true);
+
+  // Step is multiplied by 3 from the third key press on, and stops at 9 before leaving the range of digits
+  const char expected[] = "12589-";
+  GEMController& controller = menu.getController();
+  for (byte i = 0; i < sizeof(expected) - 1; i++) {
+    menu.registerKeyPress(GEM_KEY_UP);
+    char digit = controller.valueString[controller.editValueVirtualCursorPosition];
+    if (digit != expected[i]) {
+      printf("FAIL key press %d of accelerated edit of digit: '%c', expected '%c'\n", (int)i + 1, digit, expected[i]);
+      failures++;
+    }
+  }
+  menu.registerKeyPress(GEM_KEY_CANCEL);
+}
+
+// Menu item with lookup of the selected option exposed to the tests
+class TestItem : public GEMItem {
+  public:
+    using GEMItem::GEMItem;
+    using GEMItem::getSelectedOptionNum;
+    using GEMItem::selectOptionNum;
+};
+
+// Each of the menu items sharing the select remembers the option its own variable was resolved to
+
+static void testSharedSelect() {
+  SelectOptionInt options[] = {{"Low", 10}, {"Mid", 20}, {"High", 30}};
+  GEMSelect select(sizeof(options) / sizeof(SelectOptionInt), options);
+  int first = 10;
+  int second = 30;
+  TestItem menuItemFirst("First", first, select);
+  TestItem menuItemSecond("Second", second, select);
+
+  for (byte i = 0; i < 2; i++) {
+    CHECK_INT(menuItemFirst.getSelectedOptionNum(), 0);
+    CHECK_INT(menuItemSecond.getSelectedOptionNum(), 2);
+  }
+  CHECK_INT(menuItemFirst.selectOptionNum, 0);
+  CHECK_INT(menuItemSecond.selectOptionNum, 2);
+
+  first = 20;
+  CHECK_INT(menuItemFirst.getSelectedOptionNum(), 1);
+  CHECK_INT(menuItemSecond.selectOptionNum, 2);
+  first = 25;
+  CHECK_INT(menuItemFirst.getSelectedOptionNum(), -1);
+}
+
+// Switching to another controller discards whatever was pending for the previous one, so the first frame drawn afterwards
+// is the same as the one drawn by the menu object the new controller belongs to
+
+static U8G2 u8g2Shared;
+
+static void testSetController() {
+  int number = 0;
+  GEMItem menuItemNumber("Number", number);
+  GEMPage pageOwn("Own");
+  pageOwn.addMenuItem(menuItemNumber);
+  char text[GEM_STR_LEN] = "Shared";
+  bool flag = true;
+  GEMItem menuItemText("Text", text);
+  GEMItem menuItemFlag("Flag", flag);
+  GEMPage pageShared("Shared");
+  pageShared.addMenuItem(menuItemText).addMenuItem(menuItemFlag);
+
+  GEM_u8g2 menuShared(u8g2Shared, GEM_POINTER_ROW, 5);
+  menuShared.setSplashDelay(0);
+  menuShared.init();
+  menuShared.setMenuPageCurrent(pageShared);
+  menuShared.drawMenu();
+  menuShared.registerKeyPress(GEM_KEY_DOWN);
+
+  // Menu object with changes left pending for its own controller: edit mode entered, cursor moved, digit changed
+  GEM_u8g2 menu(u8g2, GEM_POINTER_ROW, 5);
+  menu.setSplashDelay(0);
+  menu.init();
+  menu.setMenuPageCurrent(pageOwn);
+  menu.drawMenu();
+  menu.enableDeferredDrawing();
+  menu.registerKeyPress(GEM_KEY_OK);
+  menu.registerKeyPress(GEM_KEY_RIGHT);
+  menu.registerKeyPress(GEM_KEY_UP);
+  menu.getController().invalidateMenuItem(menuItemNumber);
+
+  // First frame is the whole menu drawn once, with nothing drawn on top of it for the previous controller
+  u8g2Shared.resetCounters();
+  menuShared.drawMenu();
+  menu.setController(menuShared.getController());
+  u8g2.resetCounters();
+  menu.drawPending();
+  CHECK_INT(memcmp(u8g2.display, u8g2Shared.display, sizeof(u8g2.display)) == 0, true);
+  CHECK_INT(u8g2.ops, u8g2Shared.ops);
+
+  // Key presses registered with the menu object the controller belongs to are drawn by both of them
+  menuShared.registerKeyPress(GEM_KEY_UP);
+  menu.drawPending();
+  CHECK_INT(memcmp(u8g2.display, u8g2Shared.display, sizeof(u8g2.display)) == 0, true);
+}
+
+#ifdef GEM_ENABLE_ADVANCED_MODE
+// Overrides of navigation and edit methods live on the controller (the ones of the menu object are final)
+
+class CountingController : public GEMController {
+  public:
+    byte nextMenuItemCalls = 0;
+    byte nextEditValueDigitCalls = 0;
+  protected:
+    void nextMenuItem() override {
+      nextMenuItemCalls++;
+      GEMController::nextMenuItem();
+    }
+    void nextEditValueDigit() override {
+      nextEditValueDigitCalls++;
+      GEMController::nextEditValueDigit();
+    }
+};
+
+static void testControllerOverrides() {
+  int number = 0;
+  GEMItem menuItemFirst("First");
+  GEMItem menuItemNumber("Number", number);
+  GEMPage page("Overrides");
+  page.addMenuItem(menuItemFirst).addMenuItem(menuItemNumber);
+  CountingController controller;
+  GEM_u8g2 menu(u8g2, GEM_POINTER_ROW, 5);
+  menu.setSplashDelay(0);
+  menu.setController(controller);
+  menu.init();
+  menu.setMenuPageCurrent(page);
+  menu.drawMenu();
+
+  menu.registerKeyPress(GEM_KEY_DOWN);
+  CHECK_INT(controller.nextMenuItemCalls, 1);
+  CHECK_INT(page.getCurrentMenuItemIndex(), 1);
+  menu.registerKeyPress(GEM_KEY_OK);
+  menu.registerKeyPress(GEM_KEY_UP);
+  CHECK_INT(controller.nextEditValueDigitCalls, 1);
+  menu.registerKeyPress(GEM_KEY_CANCEL);
+}
+#endif
+
+#ifdef GEM_ENABLE_REFRESH
+// Menu item with the key of the drawn value exposed to the tests
+class RefreshItem : public GEMItem {
+  public:
+    using GEMItem::GEMItem;
+    using GEMItem::getValueHash;
+};
+
+// Values that fit into 32 bits are compared as is, so that no change of them is missed by refresh()
+
+static void testValueHash() {
+  int number = 0;
+  RefreshItem menuItemNumber("Number", number);
+  for (long i = -32768; i < 32768; i++) {
+    number = (int)i;
+    if (menuItemNumber.getValueHash() != (uint32_t)number) {
+      printf("FAIL getValueHash() of int %ld\n", i);
+      failures++;
+      break;
+    }
+  }
+
+  bool flag = false;
+  RefreshItem menuItemFlag("Flag", flag);
+  uint32_t flagHash = menuItemFlag.getValueHash();
+  flag = true;
+  CHECK_INT(menuItemFlag.getValueHash() != flagHash, true);
+
+  // Change of precision alone changes the drawn value of GEMFixed as well
+  GEMFixed fixed = {-2150, 2};
+  RefreshItem menuItemFixed("Fixed", fixed);
+  uint32_t fixedHash = menuItemFixed.getValueHash();
+  fixed.precision = 3;
+  CHECK_INT(menuItemFixed.getValueHash() != fixedHash, true);
+  fixed.precision = 2;
+  CHECK_INT(menuItemFixed.getValueHash() == fixedHash, true);
+  fixed.value = -2151;
+  CHECK_INT(menuItemFixed.getValueHash() != fixedHash, true);
+}
+#endif
+
+int main() {
+  for (GEMIndex i = 0; i < PROVIDER_COUNT; i++) {
+    snprintf(providerTitles[i], GEM_STR_LEN, "Item %d", (int)i);
+  }
+
+  testProviderLookups();
+  testProviderEditDraw();
+  testDigitAcceleration();
+  testSharedSelect();
+  testSetController();
+  #ifdef GEM_ENABLE_ADVANCED_MODE
+  testControllerOverrides();
+  #endif
+  #ifdef GEM_ENABLE_REFRESH
+  testValueHash();
+  #endif
+
+  if (failures == 0) {
+    printf("All checks passed\n");
+  }
+  return failures;
+}
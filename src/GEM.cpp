@@ -39,25 +39,6 @@
 
 #include "sprites/sprites-glcd-default.h"
 
-// AVR-based Arduinos have suppoort for dtostrf, some others may require manual inclusion (e.g. SAMD),
-// see https://github.com/plotly/arduino-api/issues/38#issuecomment-108987647
-#if defined(GEM_SUPPORT_FLOAT_EDIT) && (defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52840))
-#include <avr/dtostrf.h>
-#endif
-
-// Macro constants (aliases) for some of the ASCII character codes
-#define GEM_CHAR_CODE_9 57
-#define GEM_CHAR_CODE_0 48
-#define GEM_CHAR_CODE_MINUS 45
-#define GEM_CHAR_CODE_DOT 46
-#define GEM_CHAR_CODE_SPACE 32
-#define GEM_CHAR_CODE_UNDERSCORE 95
-#define GEM_CHAR_CODE_LINE 124
-#define GEM_CHAR_CODE_TILDA 126
-#define GEM_CHAR_CODE_BANG 33
-#define GEM_CHAR_CODE_a 97
-#define GEM_CHAR_CODE_ACCENT 96
-
 // Sprite of the default GEM _splash screen (GEM logo v1)
 /*
 #define logo_width  15
@@ -89,12 +70,11 @@ GEM::GEM(GLCD& glcd_, byte menuPointerType_, byte menuItemsPerScreen_, byte menu
   _appearance.menuValuesLeftOffset = menuValuesLeftOffset_;
   _appearance.sprites = sprites_;
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo;
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->_skipLineChar = true;
+  _controller->attachView(_view);
 }
 
 GEM::GEM(GLCD& glcd_, GEMAppearance appearance_)
@@ -102,12 +82,11 @@ GEM::GEM(GLCD& glcd_, GEMAppearance appearance_)
   , _appearance(appearance_)
 {
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo;
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->_skipLineChar = true;
+  _controller->attachView(_view);
 }
 
 //====================== APPEARANCE OPERATIONS
@@ -116,37 +95,50 @@ void GEM::uploadSprites() {
   // Total of 6 sprites can be loaded into RAM of the SparkFun Graphic LCD Serial Backpack,
   // so there is no room for separate GEM_ICON_SPINNER_ARROWS icon, hence GEM_ICON_SELECT_ARROWS is used instead
   byte len = sizeof(spritesDefault_glcd)/sizeof(spritesDefault_glcd[0]);
-  void* pSprites = getCurrentAppearance()->sprites == nullptr ? spritesDefault_glcd : getCurrentAppearance()->sprites;
+  void* pSprites = _layout.appearance->sprites == nullptr ? spritesDefault_glcd : _layout.appearance->sprites;
   GEMSprite* (*pSpritesCast)[len] = static_cast<GEMSprite* (*)[len]>(pSprites);
   for (int i = 0; i < len; i++) {
     _glcd.loadSprite_P(i, (*pSpritesCast)[i]->image);
   }
+  _spritesMenuPage = _controller->menuPageCurrent;
 }
 
 GEM& GEM::setAppearance(GEMAppearance appearance) {
   _appearance = appearance;
+  updateLayout();
   uploadSprites();
   return *this;
 }
 
 GEMAppearance* GEM::getCurrentAppearance() {
-  return (_menuPageCurrent != nullptr && _menuPageCurrent->_appearance != nullptr) ? _menuPageCurrent->_appearance : &_appearance;
+  return (_controller->menuPageCurrent != nullptr && _controller->menuPageCurrent->_appearance != nullptr) ? _controller->menuPageCurrent->_appearance : &_appearance;
+}
+
+void GEM::updateLayout() {
+  GEMAppearance* appearance = getCurrentAppearance();
+  byte menuItemFontSize = appearance->menuItemHeight >= 8 ? 0 : 1;
+  _layout.appearance = appearance;
+  _layout.menuItemsPerScreen = appearance->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_glcd.ydim - appearance->menuPageScreenTopOffset) / appearance->menuItemHeight : appearance->menuItemsPerScreen;
+  _layout.menuItemFontSize = menuItemFontSize;
+  _layout.menuItemTitleLength = (appearance->menuValuesLeftOffset - 5) / _menuItemFont[menuItemFontSize].width;
+  _layout.menuItemValueLength = (_glcd.xdim - appearance->menuValuesLeftOffset - 6) / _menuItemFont[menuItemFontSize].width;
+  _layout.menuItemInsetOffset = (appearance->menuItemHeight - _menuItemFont[menuItemFontSize].height) / 2;
 }
 
 byte GEM::getMenuItemsPerScreen() {
-  return getCurrentAppearance()->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_glcd.ydim - getCurrentAppearance()->menuPageScreenTopOffset) / getCurrentAppearance()->menuItemHeight : getCurrentAppearance()->menuItemsPerScreen;
+  return _layout.menuItemsPerScreen;
 }
 
 byte GEM::getMenuItemFontSize() {
-  return getCurrentAppearance()->menuItemHeight >= 8 ? 0 : 1;
+  return _layout.menuItemFontSize;
 }
 
 byte GEM::getMenuItemTitleLength() {
-  return (getCurrentAppearance()->menuValuesLeftOffset - 5) / _menuItemFont[getMenuItemFontSize()].width;
+  return _layout.menuItemTitleLength;
 }
 
 byte GEM::getMenuItemValueLength() {
-  return (_glcd.xdim - getCurrentAppearance()->menuValuesLeftOffset - 6) / _menuItemFont[getMenuItemFontSize()].width;
+  return _layout.menuItemValueLength;
 }
 
 //====================== INIT OPERATIONS
@@ -172,11 +164,50 @@ GEM& GEM::hideVersion(bool flag) {
 }
 
 GEM& GEM::invertKeysDuringEdit(bool invert) {
-  _invertKeysDuringEdit = invert;
+  _controller->_invertKeysDuringEdit = invert;
+  return *this;
+}
+
+GEM& GEM::setCharAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_charAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
+
+GEM& GEM::setDigitAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_digitAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
+
+GEM& GEM::enableDeferredDrawing(bool flag) {
+  _deferredDrawing = flag;
+  if (!_deferredDrawing) {
+    flushPendingDraw();
+  }
+  return *this;
+}
+
+GEM& GEM::setMaxFrameRate(byte fps) {
+  _maxFrameRate = fps;
   return *this;
 }
 
 GEM& GEM::init() {
+  initAsync();
+  if (_splashState != GEM_SPLASH_NONE) {
+    if (_enableVersion) {
+      delay(_splashDelay / 2);
+      drawSplashVersion();
+      delay(_splashDelay / 2);
+    } else {
+      delay(_splashDelay);
+    }
+    finishSplash();
+  }
+  return *this;
+}
+
+GEM& GEM::initAsync() {
+  updateLayout();
   uploadSprites();
 
   _glcd.drawMode(GLCD_MODE_NORMAL);
@@ -185,32 +216,54 @@ GEM& GEM::init() {
   _glcd.set(GLCD_ID_SCROLL, 0);
   _glcd.clearScreen();
 
+  _splashState = GEM_SPLASH_NONE;
   if (_splashDelay > 0) {
-
     _glcd.bitblt_P(_glcd.xdim / 2 - (pgm_read_byte(_splash.image) + 1) / 2, _glcd.ydim/2 - (pgm_read_byte(_splash.image + 1) + 1) / 2, GLCD_MODE_NORMAL, _splash.image);
+    _splashState = GEM_SPLASH_LOGO;
+    _splashStart = millis();
+  }
 
-    if (_enableVersion) {
-      delay(_splashDelay / 2);
-      _glcd.fontFace(1);
-      _glcd.setY(_glcd.ydim - 6);
-      if (_splash.image != logo_bits) {
-        _glcd.setX(_glcd.xdim - strlen(GEM_VER) * 4 - 12);
-        _glcd.putstr((char*)"GEM");
-      } else {
-        _glcd.setX(_glcd.xdim - strlen(GEM_VER) * 4);
-      }
-      _glcd.putstr((char*)GEM_VER);
-      delay(_splashDelay / 2);
-    } else {
-      delay(_splashDelay);
+  return *this;
+}
+
+bool GEM::poll() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    unsigned long elapsed = millis() - _splashStart;
+    if (elapsed >= _splashDelay) {
+      dismissSplash();
+    } else if (_splashState == GEM_SPLASH_LOGO && _enableVersion && elapsed >= _splashDelay / 2) {
+      drawSplashVersion();
+      _splashState = GEM_SPLASH_VERSION;
     }
+  }
+  return _splashState != GEM_SPLASH_NONE;
+}
 
+void GEM::dismissSplash() {
+  finishSplash();
+  if (_controller->menuPageCurrent != nullptr) {
+    drawMenu();
   }
+}
 
-  return *this;
+void GEM::drawSplashVersion() {
+  _glcd.fontFace(1);
+  _glcd.setY(_glcd.ydim - 6);
+  if (_splash.image != logo_bits) {
+    _glcd.setX(_glcd.xdim - strlen(GEM_VER) * 4 - 12);
+    _glcd.putstr((char*)"GEM");
+  } else {
+    _glcd.setX(_glcd.xdim - strlen(GEM_VER) * 4);
+  }
+  _glcd.putstr((char*)GEM_VER);
+}
+
+void GEM::finishSplash() {
+  _splashState = GEM_SPLASH_NONE; // Splash screen is overwritten by the subsequent call to drawMenu()
 }
 
 GEM& GEM::reInit() {
+  updateLayout();
   uploadSprites();
   _glcd.drawMode(GLCD_MODE_NORMAL);
   _glcd.fontMode(GLCD_MODE_NORMAL);
@@ -221,13 +274,28 @@ GEM& GEM::reInit() {
 }
 
 GEM& GEM::setMenuPageCurrent(GEMPage& menuPageCurrent) {
-  _menuPageCurrent = &menuPageCurrent;
+  _controller->setMenuPageCurrent(menuPageCurrent);
+  updateLayout();
   uploadSprites();
   return *this;
 }
 
 GEMPage* GEM::getCurrentMenuPage() {
-  return _menuPageCurrent;
+  return _controller->menuPageCurrent;
+}
+
+GEM& GEM::setController(GEMController& controller) {
+  _controller->detachView(_view);
+  _controller = &controller;
+  _controller->_skipLineChar = true; // Values shared with other menu objects are edited without '|' character as well
+  _view = GEMView(); // Nothing pending for the previous controller (changed parts, dirty range, position of the edit cursor) applies to the new one
+  _controller->attachView(_view);
+  _view.dirty = GEM_DIRTY_MENU;
+  return *this;
+}
+
+GEMController& GEM::getController() {
+  return *_controller;
 }
 
 //====================== CONTEXT OPERATIONS
@@ -243,16 +311,155 @@ GEM& GEM::clearContext() {
 //====================== DRAW OPERATIONS
 
 GEM& GEM::drawMenu() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Menu is drawn once splash screen is dismissed
+    return *this;
+  }
+  updateLayout();
+  if (_spritesMenuPage != _controller->menuPageCurrent) {
+    uploadSprites();
+  }
+  if (_controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+  }
+  GEM_PROFILE_FRAME_BEGIN();
+  _view.dirty = 0; // Everything is drawn anew
+  _drawnMenuPage = _controller->menuPageCurrent;
+  _drawnItemNum = _controller->menuPageCurrent->currentItemNum;
   _glcd.clearScreen();
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_TITLE);
   drawTitleBar();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_ITEMS);
   printMenuItems();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_POINTER);
   drawMenuPointer();
+  if (_controller->editValueMode) {
+    drawEditValue();
+  }
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_SCROLLBAR);
   drawScrollbar();
+  GEM_PROFILE_PHASE_END();
   if (drawMenuCallback != nullptr) {
+    GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_CALLBACK);
     drawMenuCallback();
+    GEM_PROFILE_PHASE_END();
+  }
+  GEM_PROFILE_FRAME_END();
+  return *this;
+}
+
+GEM& GEM::drawPending() {
+  if (_view.dirty != 0 && (_maxFrameRate == 0 || millis() - _lastFrameTime >= 1000 / _maxFrameRate)) {
+    flushPendingDraw();
+  }
+  return *this;
+}
+
+#ifdef GEM_ENABLE_REFRESH
+GEM& GEM::refresh() {
+  if (_controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    return *this;
+  }
+  flushPendingDraw();
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  byte menuItemHeight = _layout.appearance->menuItemHeight;
+  byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  bool rowPointer = _layout.appearance->menuPointerType != GEM_POINTER_DASH;
+  GEMItem* menuItemCurrent = _controller->menuPageCurrent->getCurrentMenuItem();
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(_controller->menuPageCurrent->currentItemNum / menuItemsPerScreen * menuItemsPerScreen);
+  byte y = _layout.appearance->menuPageScreenTopOffset;
+  bool changed = false;
+  for (byte i = 0; menuItemTmp != nullptr && i < menuItemsPerScreen; i++) {
+    if (menuItemTmp->type == GEM_ITEM_VAL && !(_controller->editValueMode && menuItemTmp == menuItemCurrent)) {
+      uint32_t hash = menuItemTmp->getValueHash();
+      if (_drawnValues.changed(menuItemTmp, hash)) {
+        if (!changed) {
+          GEM_PROFILE_FRAME_BEGIN();
+          changed = true;
+        }
+        bool pointerOver = rowPointer && menuItemTmp == menuItemCurrent;
+        if (pointerOver) {
+          drawMenuPointer(); // Pointer is drawn in XOR mode, hence it is erased by drawing it once again at the same position
+        }
+        // Only the value is cleared (without the pixels shared with the neighbouring rows), title of the menu item is left untouched
+        _glcd.fillBox(menuValuesLeftOffset - 1, y, _glcd.xdim - 3, y + menuItemHeight - 2, 0x00);
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+        byte yDraw = y + getMenuItemInsetOffset();
+        _glcd.setY(yDraw);
+        drawMenuItemValue(menuItemTmp, yDraw);
+        _drawnValues.store(menuItemTmp, hash);
+        if (pointerOver) {
+          drawMenuPointer();
+        }
+      }
+    }
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    y += menuItemHeight;
+  }
+  if (changed) {
+    GEM_PROFILE_FRAME_END();
   }
   return *this;
 }
+#endif
+
+void GEM::flushPendingDraw() {
+  byte dirty = _view.dirty & ~GEM_DIRTY_ITEMS;
+  if (_view.dirty == 0 || _controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    // Nothing changed since the last frame (or menu is not displayed)
+    return;
+  }
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  GEMIndex currentItemNum = _controller->menuPageCurrent->currentItemNum;
+  if (_view.areMenuItemsDirty(currentItemNum / menuItemsPerScreen * menuItemsPerScreen, menuItemsPerScreen)) {
+    dirty |= GEM_DIRTY_MENU; // Changed menu items are drawn along with the whole menu
+  } else if (dirty == 0) {
+    // None of the changed menu items is on the current screen
+    _view.dirty = 0;
+    return;
+  }
+  #ifdef GEM_ENABLE_REFRESH
+  if (dirty & (GEM_DIRTY_EDIT | GEM_DIRTY_VALUE)) {
+    _drawnValues.invalidate(_controller->menuPageCurrent->getCurrentMenuItem()); // Value is drawn by edit mode (or toggled in place), so it is repainted by the next refresh()
+  }
+  #endif
+  GEM_PROFILE_FRAME_BEGIN();
+  bool rowPointer = _layout.appearance->menuPointerType != GEM_POINTER_DASH;
+  if ((dirty & GEM_DIRTY_MENU) || _drawnMenuPage != _controller->menuPageCurrent || _drawnItemNum / menuItemsPerScreen != currentItemNum / menuItemsPerScreen) {
+    drawMenu();
+  } else if (dirty == GEM_DIRTY_POINTER) {
+    if (_drawnItemNum != currentItemNum) {
+      if (rowPointer) {
+        // Pointer is drawn in XOR mode, hence it is erased by drawing it once again at the same position
+        _controller->menuPageCurrent->currentItemNum = _drawnItemNum;
+        drawMenuPointer();
+        _controller->menuPageCurrent->currentItemNum = currentItemNum;
+      }
+      drawMenuPointer();
+    }
+  } else if (dirty == GEM_DIRTY_VALUE && !_controller->editValueMode) {
+    drawCheckbox();
+  } else if (dirty == GEM_DIRTY_EDIT && _controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+    if (rowPointer) {
+      drawMenuPointer(); // Pointer is drawn in XOR mode, hence it is erased by drawing it once again at the same position
+    }
+    drawEditValueCursor();
+  } else if (_controller->editValueMode && !(dirty & (GEM_DIRTY_POINTER | GEM_DIRTY_EDIT))) {
+    if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+      drawEditValueSelect();
+    } else {
+      moveEditValueCursor(dirty);
+    }
+  } else {
+    drawMenu();
+  }
+  _view.dirty = 0;
+  _drawnItemNum = currentItemNum;
+  GEM_PROFILE_FRAME_END();
+  _lastFrameTime = millis();
+}
 
 GEM& GEM::setDrawMenuCallback(void (*drawMenuCallback_)()) {
   drawMenuCallback = drawMenuCallback_;
@@ -267,7 +474,15 @@ GEM& GEM::removeDrawMenuCallback() {
 void GEM::drawTitleBar() {
   _glcd.fontFace(1);
   _glcd.setXY(5,1);
-  _glcd.putstr((char*)_menuPageCurrent->title);
+  if (_controller->menuPageCurrent->titleProgmem) {
+    char c;
+    for (byte i = 0; (c = GEMFormat::readChar(_controller->menuPageCurrent->title, i, true)) != '\0'; i++) {
+      _glcd.put(c);
+    }
+  } else {
+    _glcd.putstr((char*)_controller->menuPageCurrent->title);
+  }
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, GEMFormat::length(_controller->menuPageCurrent->title, _controller->menuPageCurrent->titleProgmem));
   _glcd.fontFace(getMenuItemFontSize());
 }
 
@@ -275,7 +490,7 @@ GEMSprite* GEM::getSprite(byte spriteId) {
   GEMSprite* sprite = nullptr;
   byte len = sizeof(spritesDefault_glcd)/sizeof(spritesDefault_glcd[0]);
   if (spriteId < len) {
-    void* pSprites = getCurrentAppearance()->sprites == nullptr ? spritesDefault_glcd : getCurrentAppearance()->sprites;
+    void* pSprites = _layout.appearance->sprites == nullptr ? spritesDefault_glcd : _layout.appearance->sprites;
     GEMSprite* (*pSpritesCast)[len] = static_cast<GEMSprite* (*)[len]>(pSprites);
     sprite = (*pSpritesCast)[spriteId];
   }
@@ -293,6 +508,7 @@ void GEM::drawSprite(uint8_t x, uint8_t y, byte spriteId, uint8_t mode, GEMItem*
       byte menuItemFontSize = getMenuItemFontSize();
       int offset = withInsetOffset ? (_menuItemFont[menuItemFontSize].height - sprite->height) / 2 : 0; // With additional offset for centered vertical alignment with text
       _glcd.drawSprite(x, y + offset, spriteId, mode);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_BITMAP, 1);
     }
   }
 }
@@ -307,34 +523,52 @@ GEM& GEM::removeDrawSpriteCallback() {
   return *this;
 }
 
-void GEM::printMenuItemString(const char* str, byte num, byte startPos) {
+#ifdef GEM_ENABLE_PROFILING
+GEMProfiler& GEM::getProfiler() {
+  return _profiler;
+}
+#endif
+
+void GEM::printMenuItemString(const char* str, byte num, byte startPos, bool progmem) {
   byte i = startPos;
-  while (i < num + startPos && str[i] != '\0') {
-    _glcd.put(str[i]);
+  char c;
+  while (i < num + startPos && (c = GEMFormat::readChar(str, i, progmem)) != '\0') {
+    _glcd.put(c);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
     i++;
   }
 }
 
-void GEM::printMenuItemTitle(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + offset);
+void GEM::printMenuItemTitle(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + offset, 0, progmem);
 }
 
-void GEM::printMenuItemValue(const char* str, int offset, byte startPos) {
-  printMenuItemString(str, getMenuItemValueLength() + offset, startPos);
+void GEM::printMenuItemValue(const char* str, int offset, byte startPos, bool progmem) {
+  printMenuItemString(str, getMenuItemValueLength() + offset, startPos, progmem);
+}
+
+char* GEM::formatMenuItemValue(GEMItem* menuItemTmp, byte linkedType, char* valueStringTmp) {
+  char* valueString = valueStringTmp;
+  #ifdef GEM_ENABLE_VALUE_CACHE
+  byte precision = (linkedType == GEM_VAL_FIXED) ? ((GEMFixed*)menuItemTmp->linkedVariable)->precision : menuItemTmp->precision;
+  if (_valueCache.lookup(menuItemTmp, linkedType, precision, menuItemTmp->linkedVariable, valueString)) {
+    // Value hasn't changed since it was formatted the last time
+    return valueString;
+  }
+  #endif
+  return GEMFormat::formatValue(menuItemTmp->linkedVariable, linkedType, menuItemTmp->precision, valueString);
 }
 
-void GEM::printMenuItemFull(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset);
+void GEM::printMenuItemFull(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset, 0, progmem);
 }
 
 byte GEM::getMenuItemInsetOffset() {
-  byte menuItemFontSize = getMenuItemFontSize();
-  byte menuItemInsetOffset = (getCurrentAppearance()->menuItemHeight - _menuItemFont[menuItemFontSize].height) / 2;
-  return menuItemInsetOffset;
+  return _layout.menuItemInsetOffset;
 }
 
 byte GEM::getCurrentItemTopOffset(bool withInsetOffset) {
-  return (_menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * getCurrentAppearance()->menuItemHeight + getCurrentAppearance()->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
+  return (_controller->menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * _layout.appearance->menuItemHeight + _layout.appearance->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
 }
 
 byte GEM::calculateSpriteOverlap(byte spriteId) {
@@ -343,11 +577,13 @@ byte GEM::calculateSpriteOverlap(byte spriteId) {
 
 void GEM::printMenuItems() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte currentPageScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-  GEMItem* menuItemTmp = _menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
-  byte y = getCurrentAppearance()->menuPageScreenTopOffset;
+  GEMIndex currentPageScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
+  #ifdef GEM_ENABLE_REFRESH
+  GEMItem* menuItemEdited = _controller->editValueMode ? _controller->menuPageCurrent->getCurrentMenuItem() : nullptr; // Looked up once, before menu items of the screen are stepped through
+  #endif
+  byte y = _layout.appearance->menuPageScreenTopOffset;
   byte i = 0;
-  char valueStringTmp[GEM_STR_LEN];
   while (menuItemTmp != nullptr && i < menuItemsPerScreen) {
     byte yDraw = y + getMenuItemInsetOffset();
     byte yText = yDraw;
@@ -356,88 +592,30 @@ void GEM::printMenuItems() {
       case GEM_ITEM_VAL:
         {
           _glcd.setX(5);
-          if (menuItemTmp->readonly) {
-            printMenuItemTitle(menuItemTmp->title, -1);
+          if (menuItemTmp->flags.readonly) {
+            printMenuItemTitle(menuItemTmp->title, -1, menuItemTmp->flags.titleProgmem);
             _glcd.putstr((char*)"^");
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
           } else {
-            printMenuItemTitle(menuItemTmp->title);
+            printMenuItemTitle(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
           }
 
-          byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-          _glcd.setX(menuValuesLeftOffset);
-          switch (menuItemTmp->linkedType) {
-            case GEM_VAL_INTEGER:
-              itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-              printMenuItemValue(valueStringTmp);
-              break;
-            case GEM_VAL_BYTE:
-              itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-              printMenuItemValue(valueStringTmp);
-              break;
-            case GEM_VAL_CHAR:
-              printMenuItemValue((char*)menuItemTmp->linkedVariable);
-              break;
-            case GEM_VAL_BOOL:
-              if (*(bool*)menuItemTmp->linkedVariable) {
-                drawSprite(menuValuesLeftOffset, yDraw, GEM_ICON_CHECKBOX_CHECKED, GLCD_MODE_NORMAL, menuItemTmp);
-              } else {
-                drawSprite(menuValuesLeftOffset, yDraw, GEM_ICON_CHECKBOX_UNCHECKED, GLCD_MODE_NORMAL, menuItemTmp);
-              }
-              break;
-            case GEM_VAL_SELECT:
-              {
-                GEMSelect* select = menuItemTmp->select;
-                printMenuItemValue(select->getSelectedOptionName(menuItemTmp->linkedVariable),  -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
-                drawSprite(_glcd.xdim - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, GLCD_MODE_NORMAL, menuItemTmp);
-              }
-              break;
-            #ifdef GEM_SUPPORT_SPINNER
-            case GEM_VAL_SPINNER:
-              {
-                GEMSpinner* spinner = menuItemTmp->spinner;
-                switch (spinner->getType()) {
-                  case GEM_VAL_BYTE:
-                    itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                    break;
-                  case GEM_VAL_INTEGER:
-                    itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                    break;
-                  #ifdef GEM_SUPPORT_FLOAT_EDIT
-                  case GEM_VAL_FLOAT:
-                    dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                    break;
-                  case GEM_VAL_DOUBLE:
-                    dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                    break;
-                  #endif
-                }
-                printMenuItemValue(valueStringTmp, -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
-                drawSprite(_glcd.xdim - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, GLCD_MODE_NORMAL, menuItemTmp);
-              }
-              break;
-            #endif
-            #ifdef GEM_SUPPORT_FLOAT_EDIT
-            case GEM_VAL_FLOAT:
-              // sprintf(valueStringTmp,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-              dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-              printMenuItemValue(valueStringTmp);
-              break;
-            case GEM_VAL_DOUBLE:
-              // sprintf(valueStringTmp,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-              dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-              printMenuItemValue(valueStringTmp);
-              break;
-            #endif
+          drawMenuItemValue(menuItemTmp, yDraw);
+          #ifdef GEM_ENABLE_REFRESH
+          if (!(menuItemTmp == menuItemEdited)) {
+            _drawnValues.store(menuItemTmp, menuItemTmp->getValueHash());
           }
+          #endif
           break;
         }
       case GEM_ITEM_LINK:
         _glcd.setX(5);
-        if (menuItemTmp->readonly) {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1, menuItemTmp->flags.titleProgmem);
           _glcd.putstr((char*)"^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT));
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT), menuItemTmp->flags.titleProgmem);
         }
         drawSprite(_glcd.xdim - getSprite(GEM_ICON_ARROW_RIGHT)->width - 2, yDraw, GEM_ICON_ARROW_RIGHT, GLCD_MODE_NORMAL, menuItemTmp);
         break;
@@ -446,49 +624,108 @@ void GEM::printMenuItems() {
         break;
       case GEM_ITEM_BUTTON:
         _glcd.setX(5 + getSprite(GEM_ICON_ARROW_BTN)->width);
-        if (menuItemTmp->readonly) {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1, menuItemTmp->flags.titleProgmem);
           _glcd.putstr((char*)"^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN));
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN), menuItemTmp->flags.titleProgmem);
         }
         drawSprite(5, yDraw, GEM_ICON_ARROW_BTN, GLCD_MODE_NORMAL, menuItemTmp);
         break;
       case GEM_ITEM_LABEL:
         _glcd.setX(5);
-        printMenuItemFull(menuItemTmp->title);
+        printMenuItemFull(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
         break;
     }
-    menuItemTmp = menuItemTmp->getMenuItemNext();
-    y += getCurrentAppearance()->menuItemHeight;
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    y += _layout.appearance->menuItemHeight;
     i++;
   }
+}
+
+void GEM::drawMenuItemValue(GEMItem* menuItemTmp, byte yDraw) {
+  char valueStringTmp[GEM_STR_LEN];
+  byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  _glcd.setX(menuValuesLeftOffset);
+  switch (menuItemTmp->linkedType) {
+    case GEM_VAL_INTEGER:
+      printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_INTEGER, valueStringTmp));
+      break;
+    case GEM_VAL_BYTE:
+      printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_BYTE, valueStringTmp));
+      break;
+    case GEM_VAL_CHAR:
+      printMenuItemValue((char*)menuItemTmp->linkedVariable);
+      break;
+    case GEM_VAL_BOOL:
+      if (*(bool*)menuItemTmp->linkedVariable) {
+        drawSprite(menuValuesLeftOffset, yDraw, GEM_ICON_CHECKBOX_CHECKED, GLCD_MODE_NORMAL, menuItemTmp);
+      } else {
+        drawSprite(menuValuesLeftOffset, yDraw, GEM_ICON_CHECKBOX_UNCHECKED, GLCD_MODE_NORMAL, menuItemTmp);
+      }
+      break;
+    case GEM_VAL_SELECT:
+      {
+        GEMSelect* select = menuItemTmp->select;
+        printMenuItemValue(select->getOptionNameByIndex(menuItemTmp->getSelectedOptionNum()), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
+        drawSprite(_glcd.xdim - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, GLCD_MODE_NORMAL, menuItemTmp);
+      }
+      break;
+    #ifdef GEM_SUPPORT_SPINNER
+    case GEM_VAL_SPINNER:
+      {
+        GEMSpinner* spinner = menuItemTmp->spinner;
+        printMenuItemValue(formatMenuItemValue(menuItemTmp, spinner->getType(), valueStringTmp), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+        drawSprite(_glcd.xdim - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, GLCD_MODE_NORMAL, menuItemTmp);
+      }
+      break;
+    #endif
+    case GEM_VAL_FIXED:
+      printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FIXED, valueStringTmp));
+      break;
+    #ifdef GEM_SUPPORT_FLOAT_EDIT
+    case GEM_VAL_FLOAT:
+      printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FLOAT, valueStringTmp));
+      break;
+    case GEM_VAL_DOUBLE:
+      printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_DOUBLE, valueStringTmp));
+      break;
+    #endif
+  }
   memset(valueStringTmp, '\0', GEM_STR_LEN - 1);
 }
 
 void GEM::drawMenuPointer() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
+  if (_controller->menuPageCurrent->itemsCount > 0) {
+    GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
     int pointerPosition = getCurrentItemTopOffset();
-    byte menuItemHeight = getCurrentAppearance()->menuItemHeight;
-    if (getCurrentAppearance()->menuPointerType == GEM_POINTER_DASH) {
-      _glcd.eraseBox(0, getCurrentAppearance()->menuPageScreenTopOffset, 1, _glcd.ydim-1);
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+    byte menuItemHeight = _layout.appearance->menuItemHeight;
+    if (_layout.appearance->menuPointerType == GEM_POINTER_DASH) {
+      _glcd.eraseBox(0, _layout.appearance->menuPageScreenTopOffset, 1, _glcd.ydim-1);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         for (byte i = 0; i < (menuItemHeight - 1) / 2; i++) {
           _glcd.drawPixel(0, pointerPosition + i * 2, GLCD_MODE_NORMAL);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _glcd.drawPixel(1, pointerPosition + i * 2 + 1, GLCD_MODE_NORMAL);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
         }
       } else {
         _glcd.drawBox(0, pointerPosition, 1, pointerPosition + menuItemHeight - 2, GLCD_MODE_NORMAL);
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       }
     } else {
       _glcd.drawMode(GLCD_MODE_XOR);
       _glcd.fillBox(0, pointerPosition-1, _glcd.xdim-3, pointerPosition + menuItemHeight - 1);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       _glcd.drawMode(GLCD_MODE_NORMAL);
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         for (byte i = 0; i < (menuItemHeight + 2) / 2; i++) {
           _glcd.drawPixel(0, pointerPosition + i * 2, GLCD_MODE_REVERSE);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _glcd.drawPixel(1, pointerPosition + i * 2 - 1, GLCD_MODE_REVERSE);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
         }
       }
     }
@@ -497,510 +734,132 @@ void GEM::drawMenuPointer() {
 
 void GEM::drawScrollbar() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte screensCount = (_menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _menuPageCurrent->itemsCount / menuItemsPerScreen : _menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
+  GEMIndex screensCount = (_controller->menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _controller->menuPageCurrent->itemsCount / menuItemsPerScreen : _controller->menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
   if (screensCount > 1) {
-    byte currentScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-    byte menuPageScreenTopOffset = getCurrentAppearance()->menuPageScreenTopOffset;
-    byte scrollbarHeight = (_glcd.ydim - menuPageScreenTopOffset + 1) / screensCount;
-    byte scrollbarPosition = currentScreenNum * scrollbarHeight + menuPageScreenTopOffset - 1;
+    GEMIndex currentScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+    byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
+    int scrollbarSpace = _glcd.ydim - menuPageScreenTopOffset + 1;
+    // When there are more screens than pixels available, scrollbar is kept 1px high and its position is scaled instead
+    byte scrollbarHeight = (screensCount <= scrollbarSpace) ? scrollbarSpace / screensCount : 1;
+    int scrollbarPosition = ((screensCount <= scrollbarSpace) ? currentScreenNum * scrollbarHeight : (long)currentScreenNum * (scrollbarSpace - 1) / (screensCount - 1)) + menuPageScreenTopOffset - 1;
     _glcd.drawLine(_glcd.xdim - 1, scrollbarPosition, _glcd.xdim - 1, scrollbarPosition + scrollbarHeight, GLCD_MODE_NORMAL);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_LINE, 1);
   }
 }
 
 //====================== MENU ITEMS NAVIGATION
 
-void GEM::nextMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-      drawMenuPointer();
-    }
-    if (_menuPageCurrent->currentItemNum == _menuPageCurrent->itemsCount-1) {
-      _menuPageCurrent->currentItemNum = 0;
-    } else {
-      _menuPageCurrent->currentItemNum++;
-    }
-    byte menuItemsPerScreen = getMenuItemsPerScreen();
-    bool redrawMenu = (_menuPageCurrent->itemsCount > menuItemsPerScreen && _menuPageCurrent->currentItemNum % menuItemsPerScreen == 0);
-    if (redrawMenu) {
-      drawMenu();
-    } else {
-      drawMenuPointer();
-    }
-  }
+GEM& GEM::goToMenuItem(GEMIndex index) {
+  _controller->goToMenuItem(index);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::prevMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-      drawMenuPointer();
-    }
-    byte menuItemsPerScreen = getMenuItemsPerScreen();
-    bool redrawMenu = (_menuPageCurrent->itemsCount > menuItemsPerScreen && _menuPageCurrent->currentItemNum % menuItemsPerScreen == 0);
-    if (_menuPageCurrent->currentItemNum == 0) {
-      _menuPageCurrent->currentItemNum = _menuPageCurrent->itemsCount-1;
-    } else {
-      _menuPageCurrent->currentItemNum--;
-    }
-    if (redrawMenu) {
-      drawMenu();
-    } else {
-      drawMenuPointer();
-    }
-  }
+GEM& GEM::goToMenuItem(GEMItem& menuItem) {
+  _controller->goToMenuItem(menuItem);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::menuItemSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp != nullptr) {
-    switch (menuItemTmp->type) {
-      case GEM_ITEM_VAL:
-        if (!menuItemTmp->readonly) {
-          enterEditValueMode();
-        }
-        break;
-      case GEM_ITEM_LINK:
-        if (!menuItemTmp->readonly) {
-          _menuPageCurrent = menuItemTmp->linkedPage;
-          uploadSprites();
-          drawMenu();
-        }
-        break;
-      case GEM_ITEM_BACK:
-        _menuPageCurrent->currentItemNum = (_menuPageCurrent->itemsCount > 1) ? 1 : 0;
-        _menuPageCurrent = menuItemTmp->linkedPage;
-        uploadSprites();
-        drawMenu();
-        break;
-      case GEM_ITEM_BUTTON:
-        if (!menuItemTmp->readonly) {
-          if (menuItemTmp->callbackWithArgs) {
-            menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-          } else {
-            menuItemTmp->callbackAction();
-          }
-        }
-        break;
-    }
-  }
+GEM& GEM::goToFirstMenuItem() {
+  _controller->goToFirstMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-//====================== VALUE EDIT
+GEM& GEM::goToLastMenuItem() {
+  _controller->goToLastMenuItem();
+  flushPendingDraw();
+  return *this;
+}
 
-void GEM::enterEditValueMode() {
-  _editValueMode = true;
-  
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-    drawMenuPointer();
-  }
-  _editValueType = menuItemTmp->linkedType;
-  switch (_editValueType) {
-    case GEM_VAL_INTEGER:
-      itoa(*(int*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 6;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BYTE:
-      itoa(*(byte*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 3;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_CHAR:
-      strcpy(_valueString, (char*)menuItemTmp->linkedVariable);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BOOL:
-      checkboxToggle();
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        _valueSelectNum = select->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        _valueSelectNum = spinner->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      // sprintf(_valueString,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_DOUBLE:
-      // sprintf(_valueString,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    #endif
-  }
+GEM& GEM::goToPrevScreen() {
+  _controller->goToPrevScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::checkboxToggle() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  int topOffset = getCurrentItemTopOffset(true);
-  bool checkboxValue = *(bool*)menuItemTmp->linkedVariable;
-  *(bool*)menuItemTmp->linkedVariable = !checkboxValue;
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    if (!_editValueMode) { // Edge case e.g. when edit mode was activated from inside callback (e.g. on another menu item)
-      drawEditValueCursor();
-      drawMenu();
-    }
-  } else {
-    byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-    if (!checkboxValue) {
-      drawSprite(menuValuesLeftOffset, topOffset, GEM_ICON_CHECKBOX_CHECKED, GLCD_MODE_NORMAL, menuItemTmp);
-    } else {
-      drawSprite(menuValuesLeftOffset, topOffset, GEM_ICON_CHECKBOX_UNCHECKED, GLCD_MODE_NORMAL, menuItemTmp);
-    }
-    if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-      drawMenuPointer();
-    }
-    _editValueMode = false;
-  }
+GEM& GEM::goToNextScreen() {
+  _controller->goToNextScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::clearValueVisibleRange() {
-  int pointerPosition = getCurrentItemTopOffset();
-  byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-  _glcd.fillBox(menuValuesLeftOffset - 1, pointerPosition - 1, _glcd.xdim - 3, pointerPosition + getCurrentAppearance()->menuItemHeight - 1, 0x00);
-  _glcd.setX(menuValuesLeftOffset);
-  _glcd.setY(pointerPosition);
+GEM& GEM::goToPrevInteractiveMenuItem() {
+  _controller->goToPrevInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::initEditValueCursor() {
-  _editValueCursorPosition = 0;
-  _editValueVirtualCursorPosition = 0;
-  drawEditValueCursor();
+GEM& GEM::goToNextInteractiveMenuItem() {
+  _controller->goToNextInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM::nextEditValueCursorPosition() {
-  drawEditValueCursor();
-  byte menuItemValueLength = getMenuItemValueLength();
-  if ((_editValueCursorPosition != menuItemValueLength - 1) && (_editValueCursorPosition != _editValueLength - 1) && (_valueString[_editValueCursorPosition] != '\0')) {
-    _editValueCursorPosition++;
+//====================== VALUE EDIT
+
+void GEM::drawCheckbox() {
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
+  bool rowPointer = _layout.appearance->menuPointerType != GEM_POINTER_DASH;
+  if (rowPointer) {
+    drawMenuPointer(); // Pointer is drawn in XOR mode, hence it is erased by drawing it once again at the same position
   }
-  if ((_editValueVirtualCursorPosition != _editValueLength - 1) && (_valueString[_editValueVirtualCursorPosition] != '\0')) {
-    _editValueVirtualCursorPosition++;
-    if (_editValueCursorPosition == menuItemValueLength - 1) {
-      clearValueVisibleRange();
-      printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
-    }
+  if (*(bool*)menuItemTmp->linkedVariable) {
+    drawSprite(_layout.appearance->menuValuesLeftOffset, getCurrentItemTopOffset(true), GEM_ICON_CHECKBOX_CHECKED, GLCD_MODE_NORMAL, menuItemTmp);
+  } else {
+    drawSprite(_layout.appearance->menuValuesLeftOffset, getCurrentItemTopOffset(true), GEM_ICON_CHECKBOX_UNCHECKED, GLCD_MODE_NORMAL, menuItemTmp);
+  }
+  if (rowPointer) {
+    drawMenuPointer();
   }
-  drawEditValueCursor();
 }
 
-void GEM::prevEditValueCursorPosition() {
-  drawEditValueCursor();
-  if (_editValueCursorPosition != 0) {
-    _editValueCursorPosition--;
-  }
-  if (_editValueVirtualCursorPosition != 0) {
-    _editValueVirtualCursorPosition--;
-    if (_editValueCursorPosition == 0) {
-      clearValueVisibleRange();
-      printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition);
-    }
-  }
-  drawEditValueCursor();
+void GEM::clearValueVisibleRange() {
+  int pointerPosition = getCurrentItemTopOffset();
+  byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  _glcd.fillBox(menuValuesLeftOffset - 1, pointerPosition - 1, _glcd.xdim - 3, pointerPosition + _layout.appearance->menuItemHeight - 1, 0x00);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+  _glcd.setX(menuValuesLeftOffset);
+  _glcd.setY(pointerPosition);
 }
 
 void GEM::drawEditValueCursor() {
   int pointerPosition = getCurrentItemTopOffset();
   byte menuItemFontSize = getMenuItemFontSize();
-  byte cursorLeftOffset = getCurrentAppearance()->menuValuesLeftOffset + _editValueCursorPosition * _menuItemFont[menuItemFontSize].width;
+  byte cursorLeftOffset = _layout.appearance->menuValuesLeftOffset + _view.editValueCursorPosition * _menuItemFont[menuItemFontSize].width;
   _glcd.drawMode(GLCD_MODE_XOR);
-  if (_editValueType == GEM_VAL_SELECT || _editValueType == GEM_VAL_SPINNER) {
-    _glcd.fillBox(cursorLeftOffset - 1, pointerPosition - 1, _glcd.xdim - 3, pointerPosition + getCurrentAppearance()->menuItemHeight - 1);
+  if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+    _glcd.fillBox(cursorLeftOffset - 1, pointerPosition - 1, _glcd.xdim - 3, pointerPosition + _layout.appearance->menuItemHeight - 1);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
   } else {
-    _glcd.fillBox(cursorLeftOffset - 1, pointerPosition - 1, cursorLeftOffset + _menuItemFont[menuItemFontSize].width - 1, pointerPosition + getCurrentAppearance()->menuItemHeight - 1);
+    _glcd.fillBox(cursorLeftOffset - 1, pointerPosition - 1, cursorLeftOffset + _menuItemFont[menuItemFontSize].width - 1, pointerPosition + _layout.appearance->menuItemHeight - 1);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
   }
   _glcd.drawMode(GLCD_MODE_NORMAL);
 }
 
-void GEM::nextEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_ACCENT:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_BANG;
-          break;
-        case GEM_CHAR_CODE_LINE - 1:
-          code = GEM_CHAR_CODE_LINE + 1;
-          break;
-        default:
-          code++;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_LINE - 1:
-          code = GEM_CHAR_CODE_LINE + 1;
-          break;
-        default:
-          code++;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_9:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_0;
-        break;
-      default:
-        code++;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
-}
-
-void GEM::prevEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        case GEM_CHAR_CODE_BANG:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_a:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        case GEM_CHAR_CODE_LINE + 1:
-          code = GEM_CHAR_CODE_LINE - 1;
-          break;
-        default:
-          code--;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_LINE + 1:
-          code = GEM_CHAR_CODE_LINE - 1;
-          break;
-        default:
-          code--;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_0:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      default:
-        code--;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
-}
-
-#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-void GEM::callPreviewCallback(bool reset) {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp->previewCallbackAction != nullptr) {
-    GEMPreviewCallbackData previewCallbackData;
-    previewCallbackData.callbackData = menuItemTmp->callbackData;
-    if (!reset) {
-      previewCallbackData.type = menuItemTmp->linkedType;
-      switch (menuItemTmp->linkedType) {
-        case GEM_VAL_INTEGER:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValInt = atoi(_valueString);
-          break;
-        case GEM_VAL_BYTE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValByte = atoi(_valueString);
-          break;
-        case GEM_VAL_CHAR:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValChar = _valueString;
-          break;
-        case GEM_VAL_SELECT:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSelect* select = menuItemTmp->select;
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            select->setValue(&previewCallbackData.previewValByte, _valueSelectNum);
-            previewCallbackData.type = select->getType();
-          }
-          break;
-        #ifdef GEM_SUPPORT_SPINNER
-        case GEM_VAL_SPINNER:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSpinner* spinner = menuItemTmp->spinner;
-            void* linkedVariable = menuItemTmp->getLinkedVariablePointer();
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            spinner->setValue(&previewCallbackData.previewValByte, _valueSelectNum, linkedVariable);
-            previewCallbackData.type = spinner->getType();
-          }
-          break;
-        #endif
-        #ifdef GEM_SUPPORT_FLOAT_EDIT
-        case GEM_VAL_FLOAT:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValFloat = atof(_valueString);
-          break;
-        case GEM_VAL_DOUBLE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValDouble = atof(_valueString);
-          break;
-        #endif
-      }
-    }
-    menuItemTmp->previewCallbackAction(previewCallbackData);
+void GEM::moveEditValueCursor(byte dirty) {
+  drawEditValueCursor(); // Cursor is drawn in XOR mode, hence it is erased by drawing it once again at the same position
+  byte offsetPrev = _view.editValueVirtualCursorPosition - _view.editValueCursorPosition;
+  _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+  byte offset = _view.editValueVirtualCursorPosition - _view.editValueCursorPosition;
+  if (offset != offsetPrev || dirty == (GEM_DIRTY_VALUE | GEM_DIRTY_CURSOR)) {
+    // Visible part of the value is scrolled (or changed digit is no longer under the cursor)
+    clearValueVisibleRange();
+    _glcd.setY(getCurrentItemTopOffset(true));
+    printMenuItemValue(_controller->valueString, 0, offset);
+  } else if (dirty & GEM_DIRTY_VALUE) {
+    _glcd.setX(_layout.appearance->menuValuesLeftOffset + _view.editValueCursorPosition * _menuItemFont[getMenuItemFontSize()].width);
+    _glcd.setY(getCurrentItemTopOffset(true));
+    _glcd.put(_controller->valueString[_controller->editValueVirtualCursorPosition]);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
   }
-}
-#endif
-
-void GEM::drawEditValueDigit(byte code) {
-  char chrNew = (char)code;
-  _valueString[_editValueVirtualCursorPosition] = chrNew;
-  drawEditValueCursor();
-  _glcd.setX(getCurrentAppearance()->menuValuesLeftOffset + _editValueCursorPosition * _menuItemFont[getMenuItemFontSize()].width);
-  int pointerPosition = getCurrentItemTopOffset(true);
-  _glcd.setY(pointerPosition);
-  _glcd.put(code);
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
   drawEditValueCursor();
 }
 
-void GEM::nextEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum+1 < select->getLength()) {
-    _valueSelectNum++;
-  } else if (select->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-
-void GEM::prevEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (select->getLoop()) {
-    _valueSelectNum = select->getLength() - 1;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-
-#ifdef GEM_SUPPORT_SPINNER
-void GEM::nextEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum+1 < spinner->getLength()) {
-    _valueSelectNum++;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-
-void GEM::prevEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = spinner->getLength() - 1;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-#endif
-
 void GEM::drawEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
   clearValueVisibleRange();
   int pointerPosition = getCurrentItemTopOffset(true);
   _glcd.setY(pointerPosition);
@@ -1009,7 +868,7 @@ void GEM::drawEditValueSelect() {
     case GEM_VAL_SELECT:
       {
         GEMSelect* select = menuItemTmp->select;
-        printMenuItemValue(select->getOptionNameByIndex(_valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+        printMenuItemValue(select->getOptionNameByIndex(_controller->valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
       }
       break;
     #ifdef GEM_SUPPORT_SPINNER
@@ -1017,7 +876,7 @@ void GEM::drawEditValueSelect() {
       {
         char valueStringTmp[GEM_STR_LEN];
         GEMSpinner* spinner = menuItemTmp->spinner;
-        GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _valueSelectNum);
+        GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _controller->valueSelectNum);
         switch (spinner->getType()) {
           case GEM_VAL_BYTE:
             itoa(valueTmp.valByte, valueStringTmp, 10);
@@ -1025,12 +884,15 @@ void GEM::drawEditValueSelect() {
           case GEM_VAL_INTEGER:
             itoa(valueTmp.valInt, valueStringTmp, 10);
             break;
+          case GEM_VAL_FIXED:
+            GEMFormat::formatFixed(valueTmp.valFixed, ((GEMFixed*)menuItemTmp->linkedVariable)->precision, valueStringTmp);
+            break;
           #ifdef GEM_SUPPORT_FLOAT_EDIT
           case GEM_VAL_FLOAT:
-            dtostrf(valueTmp.valFloat, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+            GEMFormat::formatFloat(valueTmp.valFloat, menuItemTmp->precision, valueStringTmp);
             break;
           case GEM_VAL_DOUBLE:
-            dtostrf(valueTmp.valDouble, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+            GEMFormat::formatFloat(valueTmp.valDouble, menuItemTmp->precision, valueStringTmp);
             break;
           #endif
         }
@@ -1044,101 +906,136 @@ void GEM::drawEditValueSelect() {
   drawEditValueCursor();
 }
 
-void GEM::saveEditValue() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  switch (menuItemTmp->linkedType) {
-    case GEM_VAL_INTEGER:
-      *(int*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_BYTE:
-      *(byte*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_CHAR:
-      strcpy((char*)menuItemTmp->linkedVariable, trimString(_valueString)); // Potential overflow if string length is not defined
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        select->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        spinner->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      *(float*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    case GEM_VAL_DOUBLE:
-      *(double*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    #endif
+void GEM::drawEditValue() {
+  if (_layout.appearance->menuPointerType != GEM_POINTER_DASH) {
+    drawMenuPointer(); // Pointer is drawn in XOR mode, hence it is erased by drawing it once again at the same position
   }
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    if (!_editValueMode) { // Edge case e.g. when edit mode was activated from inside callback (e.g. on another menu item)
-      drawEditValueCursor();
-      drawMenu();
-    }
+  if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+    drawEditValueSelect();
   } else {
-    exitEditValue();
+    clearValueVisibleRange();
+    _glcd.setY(getCurrentItemTopOffset(true));
+    printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
+    drawEditValueCursor();
   }
 }
 
-void GEM::cancelEditValue() {
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback(true);
-  #endif
-  exitEditValue();
+bool GEM::isEditMode() {
+  return _controller->editValueMode;
 }
 
-void GEM::resetEditValueState() {
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
-  _editValueMode = false;
+#ifdef GEM_ENABLE_ADVANCED_MODE
+
+void GEM::nextMenuItem() {
+  _controller->nextMenuItem();
+  flushPendingDraw();
 }
 
-void GEM::exitEditValue() {
-  resetEditValueState();
-  drawEditValueCursor();
-  drawMenu();
+void GEM::prevMenuItem() {
+  _controller->prevMenuItem();
+  flushPendingDraw();
 }
 
-bool GEM::isEditMode() {
-  return _editValueMode;
+void GEM::menuItemSelect() {
+  _controller->menuItemSelect();
+  flushPendingDraw();
 }
 
-// Trim leading/trailing whitespaces
-// Author: Adam Rosenfield, https://stackoverflow.com/a/122721
-char* GEM::trimString(char* str) {
-  char *end;
+void GEM::enterEditValueMode() {
+  _controller->enterEditValueMode();
+  flushPendingDraw();
+}
 
-  // Trim leading space
-  while(isspace((unsigned char)*str)) str++;
+void GEM::checkboxToggle() {
+  _controller->checkboxToggle();
+  flushPendingDraw();
+}
 
-  if(*str == 0)  // All spaces?
-    return str;
+void GEM::initEditValueCursor() {
+  // Edit cursor on screen follows the one of the controller
+  _controller->editValueVirtualCursorPosition = 0;
+  _controller->markDirty(GEM_DIRTY_CURSOR);
+  flushPendingDraw();
+}
 
-  // Trim trailing space
-  end = str + strlen(str) - 1;
-  while(end > str && isspace((unsigned char)*end)) end--;
+void GEM::nextEditValueCursorPosition() {
+  _controller->nextEditValueCursorPosition();
+  flushPendingDraw();
+}
 
-  // Write new null terminator
-  *(end+1) = 0;
-  
-  return str;
+void GEM::prevEditValueCursorPosition() {
+  _controller->prevEditValueCursorPosition();
+  flushPendingDraw();
+}
+
+void GEM::nextEditValueDigit() {
+  _controller->nextEditValueDigit();
+  flushPendingDraw();
+}
+
+void GEM::prevEditValueDigit() {
+  _controller->prevEditValueDigit();
+  flushPendingDraw();
+}
+
+#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+void GEM::callPreviewCallback(bool reset) {
+  _controller->callPreviewCallback(reset);
+  flushPendingDraw();
+}
+
+#endif
+
+void GEM::drawEditValueDigit(byte code) {
+  _controller->setEditValueDigit(code);
+  flushPendingDraw();
+}
+
+void GEM::nextEditValueSelect() {
+  _controller->nextEditValueSelect();
+  flushPendingDraw();
 }
 
+void GEM::prevEditValueSelect() {
+  _controller->prevEditValueSelect();
+  flushPendingDraw();
+}
+
+#ifdef GEM_SUPPORT_SPINNER
+void GEM::nextEditValueSpinner() {
+  _controller->nextEditValueSpinner();
+  flushPendingDraw();
+}
+
+void GEM::prevEditValueSpinner() {
+  _controller->prevEditValueSpinner();
+  flushPendingDraw();
+}
+
+#endif
+
+void GEM::saveEditValue() {
+  _controller->saveEditValue();
+  flushPendingDraw();
+}
+
+void GEM::cancelEditValue() {
+  _controller->cancelEditValue();
+  flushPendingDraw();
+}
+
+void GEM::resetEditValueState() {
+  _controller->resetEditValueState();
+  flushPendingDraw();
+}
+
+void GEM::exitEditValue() {
+  _controller->exitEditValue();
+  flushPendingDraw();
+}
+
+#endif
+
 //====================== KEY DETECTION
 
 bool GEM::readyForKey() {
@@ -1153,11 +1050,67 @@ bool GEM::readyForKey() {
 }
 
 GEM& GEM::registerKeyPress(byte keyCode) {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Splash screen displayed by GEM::initAsync() is dismissed by the first key press (the key press is not registered otherwise)
+    if (keyCode != GEM_KEY_NONE) {
+      dismissSplash();
+    } else {
+      poll();
+    }
+    return *this;
+  }
   _currentKey = keyCode;
+  if (_deferredDrawing && context.loop == nullptr) {
+    if (keyCode == GEM_KEY_UP || keyCode == GEM_KEY_DOWN || keyCode == GEM_KEY_PAGE_UP || keyCode == GEM_KEY_PAGE_DOWN || keyCode == GEM_KEY_HOME || keyCode == GEM_KEY_END) {
+      // Navigation and value changes only mark the screen for redraw, it is drawn later by GEM::drawPending()
+      _controller->dispatchKeyPress(keyCode, getMenuItemsPerScreen());
+      return *this;
+    } else if (keyCode != GEM_KEY_NONE) {
+      // Screen should be up to date before any other action (and callbacks it may trigger) takes place
+      flushPendingDraw();
+    }
+  }
+  #ifdef GEM_ENABLE_PROFILING
+  // Everything drawn in response to the key press is recorded as a single frame
+  if (keyCode != GEM_KEY_NONE) {
+    GEM_PROFILE_FRAME_BEGIN();
+    dispatchKeyPress();
+    GEM_PROFILE_FRAME_END();
+    return *this;
+  }
+  #endif
   dispatchKeyPress();
   return *this;
 }
 
+#ifdef GEM_ENABLE_KEY_QUEUE
+bool GEM::enqueueKey(byte keyCode) {
+  return _keyQueue.push(keyCode);
+}
+
+GEM& GEM::processKeys() {
+  if (!readyForKey()) {
+    // Context loop handles key presses by itself
+    _keyQueue.clear();
+    return *this;
+  }
+  byte keyCode;
+  if (!_keyQueue.pop(keyCode)) {
+    // Context loop (if any) is called even if there is no key press, same as with registerKeyPress(GEM_KEY_NONE)
+    keyCode = GEM_KEY_NONE;
+  }
+  do {
+    registerKeyPress(keyCode);
+  } while ((context.loop == nullptr || context.allowExit) && _keyQueue.pop(keyCode));
+  drawPending();
+  return *this;
+}
+
+GEMKeyQueue& GEM::getKeyQueue() {
+  return _keyQueue;
+}
+#endif
+
 void GEM::dispatchKeyPress() {
 
   if (context.loop != nullptr) {
@@ -1173,97 +1126,11 @@ void GEM::dispatchKeyPress() {
       context.loop();
     }
   } else {
-  
-    if (_editValueMode) {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          if (_editValueType == GEM_VAL_SELECT) {
-            prevEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              prevEditValueSpinner();
-            } else {
-              nextEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            prevEditValueDigit();
-          } else {
-            nextEditValueDigit();
-          }
-          break;
-        case GEM_KEY_RIGHT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            nextEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          if (_editValueType == GEM_VAL_SELECT) {
-            nextEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              nextEditValueSpinner();
-            } else {
-              prevEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            nextEditValueDigit();
-          } else {
-            prevEditValueDigit();
-          }
-          break;
-        case GEM_KEY_LEFT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            prevEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          cancelEditValue();
-          break;
-        case GEM_KEY_OK:
-          saveEditValue();
-          break;
-      }
-    } else {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          prevMenuItem();
-          break;
-        case GEM_KEY_RIGHT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr && (
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_LINK ||
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BUTTON)) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          nextMenuItem();
-          break;
-        case GEM_KEY_LEFT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr &&
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BACK) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          if (_menuPageCurrent->getMenuItem(0) != nullptr &&
-              _menuPageCurrent->getMenuItem(0)->type == GEM_ITEM_BACK) {
-            _menuPageCurrent->currentItemNum = 0;
-            menuItemSelect();
-          } else if (_menuPageCurrent->exitAction != nullptr) {
-            _menuPageCurrent->currentItemNum = 0;
-            _menuPageCurrent->exitAction();
-          }
-          break;
-        case GEM_KEY_OK:
-          menuItemSelect();
-          break;
-      }
+    // Key codes of GEM are the same as the ones handled by the controller
+    _controller->dispatchKeyPress(_currentKey, getMenuItemsPerScreen());
+    if (_currentKey != GEM_KEY_NONE) {
+      flushPendingDraw();
     }
-
   }
 }
 
@@ -43,11 +43,17 @@
 #include "GEMSprite.h"
 #include "GEMAppearance.h"
 #include "GEMContext.h"
+#include "GEMController.h"
 #include "GEMPage.h"
 #include "GEMSelect.h"
 #ifdef GEM_SUPPORT_SPINNER
 #include "GEMSpinner.h"
 #endif
+#include "GEMProfiler.h"
+#include "GEMValueCache.h"
+#include "GEMDrawnValues.h"
+#include "GEMKeyQueue.h"
+#include "GEMFormat.h"
 #include "constants.h"
 
 // Macro constants (aliases) for the keys (buttons) used to navigate and interact with menu
@@ -58,6 +64,10 @@
 #define GEM_KEY_LEFT 4    // Left key is pressed (navigate through the Back button to the previous menu page, select previous digit/char of editable variable)
 #define GEM_KEY_CANCEL 5  // Cancel key is pressed (navigate to the previous (parent) menu page, exit edit mode without saving the variable, exit context loop if allowed within context's settings)
 #define GEM_KEY_OK 6      // Ok/Apply key is pressed (toggle bool menu item, enter edit mode of the associated non-bool variable, exit edit mode with saving the variable, execute code associated with button)
+#define GEM_KEY_PAGE_UP 7    // Page Up key is pressed (move menu pointer one screen up)
+#define GEM_KEY_PAGE_DOWN 8  // Page Down key is pressed (move menu pointer one screen down)
+#define GEM_KEY_HOME 9       // Home key is pressed (move menu pointer to the first menu item)
+#define GEM_KEY_END 10       // End key is pressed (move menu pointer to the last menu item)
 
 // Declaration of FontSize type
 struct FontSize {
@@ -115,10 +125,22 @@ class GEM {
     GEM& setSplashDelay(uint16_t value);                    // Set splash screen delay. Default value 1000ms, max value 65535ms. Setting to 0 will disable splash screen. Should be called before GEM::init().
     GEM& hideVersion(bool flag = true);                     // Turn printing of the current GEM library version on splash screen off or back on. Should be called before GEM::init().
     GEM& invertKeysDuringEdit(bool invert = true);          // Turn inverted order of characters during edit mode on or off
+    GEM& setCharAcceleration(uint16_t interval = 150, byte pressesPerStage = 10, byte factor = 5, byte maxStage = 1); // Accelerate edit of char[17] variables on rapid key presses (by default: 5 characters per key press after 10 key presses),
+                                                        // pass 0 as interval to disable acceleration. Acceleration of spinners is set with GEMSpinner::setAcceleration()
+    GEM& setDigitAcceleration(uint16_t interval = 150, byte pressesPerStage = 10, byte factor = 3, byte maxStage = 1); // Accelerate edit of digits of numeric variables on rapid key presses (by default: 3 digits per key press after 10 key presses),
+                                                        // pass 0 as interval to disable acceleration. Accelerated step stops at 9 (or 0) before leaving the range of digits
+    GEM& enableDeferredDrawing(bool flag = true);           // Defer drawing of menu navigation and value changes (GEM_KEY_UP, GEM_KEY_DOWN) until GEM::drawPending() is called,
+                                                            // so that a burst of key presses is drawn as a single frame. To disable pass false: enableDeferredDrawing(false).
+    GEM& setMaxFrameRate(byte fps);                         // Limit how often GEM::drawPending() draws deferred changes (frames per second). Default value 0 (no limit).
     GEM_VIRTUAL GEM& init();                                // Init the menu (load necessary sprites into RAM of the SparkFun Graphic LCD Serial Backpack, display GEM splash screen, etc.)
+    GEM_VIRTUAL GEM& initAsync();                       // Init the menu without waiting for the splash screen delay to elapse: splash screen is then advanced and dismissed by GEM::poll() (or by the first key press)
+    bool poll();                                        // Dismiss splash screen displayed by GEM::initAsync() once splash delay elapsed (and draw menu if menu page is set). Returns true while splash screen is displayed
     GEM_VIRTUAL GEM& reInit();                              // Reinitialize the menu (apply GEM specific settings to AltSerialGraphicLCD library)
     GEM& setMenuPageCurrent(GEMPage& menuPageCurrent);      // Set supplied menu page as current
     GEMPage* getCurrentMenuPage();                          // Get pointer to current menu page
+    GEM& setController(GEMController& controller);          // Observe navigation and edit state of the supplied controller (e.g. shared with menu object of another display),
+                                                            // menu is drawn anew on the next call to GEM::drawMenu() or GEM::drawPending()
+    GEMController& getController();                         // Get controller of the menu (the one set with GEM::setController() or the own one)
 
     /* CONTEXT OPERATIONS */
 
@@ -128,10 +150,30 @@ class GEM {
     /* DRAW OPERATIONS */
 
     GEM_VIRTUAL GEM& drawMenu();                            // Draw menu on screen, with menu page set earlier in GEM::setMenuPageCurrent()
+    GEM& drawPending();                                     // Draw changes deferred since the last frame (if any), respecting max frame rate set in GEM::setMaxFrameRate()
+    #ifdef GEM_ENABLE_REFRESH
+    GEM& refresh();                                         // Repaint values of visible menu items that changed since they were drawn (e.g. sensor readouts), leaving the rest of the screen untouched
+                                                        // (char[17], float and double values are compared by 32-bit hash: change that collides with the drawn value is not repainted)
+    #endif
     GEM& setDrawMenuCallback(void (*drawMenuCallback_)());  // Set callback that will be called at the end of GEM::drawMenu()
     GEM& removeDrawMenuCallback();                          // Remove callback that was called at the end of GEM::drawMenu()
     GEM& setDrawSpriteCallback(bool (*drawSpriteCallback_)(uint8_t x, uint8_t y, byte spriteId, uint8_t mode, GEMItem* menuItem));  // Set callback that will be called at the start of GEM::drawSprite()
     GEM& removeDrawSpriteCallback();                        // Remove callback that was called at the start of GEM::drawSprite()
+    #ifdef GEM_ENABLE_PROFILING
+    GEMProfiler& getProfiler();                             // Get profile of the last GEM_PROFILE_FRAMES frames (count of draw primitives and time spent in each of the phases of drawing)
+    #endif
+
+    /* MENU ITEMS NAVIGATION */
+
+    GEM& goToMenuItem(GEMIndex index);                  // Move menu pointer to the menu item with supplied index (among visible menu items of the current menu page)
+    GEM& goToMenuItem(GEMItem& menuItem);               // Move menu pointer to the supplied menu item of the current menu page
+    GEM& goToFirstMenuItem();                           // Move menu pointer to the first menu item (GEM_KEY_HOME)
+    GEM& goToLastMenuItem();                            // Move menu pointer to the last menu item (GEM_KEY_END)
+    GEM& goToPrevScreen();                              // Move menu pointer one screen up, stopping at the first menu item (GEM_KEY_PAGE_UP)
+    GEM& goToNextScreen();                              // Move menu pointer one screen down, stopping at the last menu item (GEM_KEY_PAGE_DOWN)
+    GEM& goToPrevInteractiveMenuItem();                 // Move menu pointer to the previous menu item that is neither label nor readonly (looping over the menu page)
+    GEM& goToNextInteractiveMenuItem();                 // Move menu pointer to the next menu item that is neither label nor readonly (looping over the menu page)
+                                                        // Menu pointer is moved at once and the menu is redrawn only once. Has no effect in edit mode
 
     /* VALUE EDIT */
 
@@ -141,86 +183,122 @@ class GEM {
 
     bool readyForKey();                                     // Checks that menu is waiting for the key press
     GEM& registerKeyPress(byte keyCode);                    // Register the key press and trigger corresponding action
-                                                            // Accepts GEM_KEY_NONE, GEM_KEY_UP, GEM_KEY_RIGHT, GEM_KEY_DOWN, GEM_KEY_LEFT, GEM_KEY_CANCEL, GEM_KEY_OK values
+                                                            // Accepts GEM_KEY_NONE, GEM_KEY_UP, GEM_KEY_RIGHT, GEM_KEY_DOWN, GEM_KEY_LEFT, GEM_KEY_CANCEL, GEM_KEY_OK values,
+                                                            // as well as optional GEM_KEY_PAGE_UP, GEM_KEY_PAGE_DOWN, GEM_KEY_HOME, GEM_KEY_END navigation keys
+    #ifdef GEM_ENABLE_KEY_QUEUE
+    bool enqueueKey(byte keyCode);                          // Put the key press into the queue to be registered later by processKeys() (safe to call from interrupt service routine)
+                                                            // Returns false if the queue is full (the key press is dropped then)
+    GEM& processKeys();                                     // Register all of the queued key presses (call it from loop() instead of readyForKey() and registerKeyPress())
+    GEMKeyQueue& getKeyQueue();                             // Get queue of key presses (e.g. to monitor count of dropped key presses)
+    #endif
   protected:
     GLCD& _glcd;
     GEMAppearance* _appearanceCurrent = nullptr;
     GEMAppearance _appearance;
+    GEMLayout _layout;
+    void updateLayout();                                        // Recalculate layout of the menu for current appearance, fonts and menu page
     GEM_VIRTUAL void uploadSprites();
     byte getMenuItemsPerScreen();
     byte getMenuItemFontSize();
     FontSize _menuItemFont[2] = {{6,8},{4,6}};
-    bool _invertKeysDuringEdit = false;
-    GEM_VIRTUAL byte getMenuItemTitleLength();
-    GEM_VIRTUAL byte getMenuItemValueLength();
+    GEM_VIRTUAL_DRAW byte getMenuItemTitleLength() GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte getMenuItemValueLength() GEM_FINAL_DRAW;
     GEMSprite _splash;
     uint16_t _splashDelay = 1000;
     bool _enableVersion = true;
+    byte _splashState = GEM_SPLASH_NONE;
+    unsigned long _splashStart = 0;
+    void drawSplashVersion();
+    void finishSplash();
+    void dismissSplash();
 
     /* DRAW OPERATIONS */
 
-    GEMPage* _menuPageCurrent = nullptr;
+    GEMController _ownController;                           // Controller of the menu unless another one is set with GEM::setController()
+    GEMController* _controller = &_ownController;           // Navigation and edit state of the menu (current menu page, value being edited)
+    GEMView _view;                                          // What is drawn on screen (parts of the menu to be redrawn, position of the edit cursor)
     void (*drawMenuCallback)() = nullptr;
+    #ifdef GEM_ENABLE_PROFILING
+    GEMProfiler _profiler;
+    #endif
+    #ifdef GEM_ENABLE_VALUE_CACHE
+    GEMValueCache _valueCache;
+    #endif
+    #ifdef GEM_ENABLE_REFRESH
+    GEMDrawnValues _drawnValues;
+    #endif
     bool (*drawSpriteCallback)(uint8_t x, uint8_t y, byte spriteId, uint8_t mode, GEMItem* menuItem) = nullptr;
     GEM_VIRTUAL void drawTitleBar();
-    GEM_VIRTUAL GEMSprite* getSprite(byte spriteId);
-    GEM_VIRTUAL void drawSprite(uint8_t x, uint8_t y, byte spriteId, uint8_t mode, GEMItem* menuItem = nullptr, bool withInsetOffset = true);
-    GEM_VIRTUAL void printMenuItemString(const char* str, byte num, byte startPos = 0);
-    GEM_VIRTUAL void printMenuItemTitle(const char* str, int offset = 0);
-    GEM_VIRTUAL void printMenuItemValue(const char* str, int offset = 0, byte startPos = 0);
-    GEM_VIRTUAL void printMenuItemFull(const char* str, int offset = 0);
-    GEM_VIRTUAL byte getMenuItemInsetOffset();
-    GEM_VIRTUAL byte getCurrentItemTopOffset(bool withInsetOffset = false);
-    GEM_VIRTUAL byte calculateSpriteOverlap(byte spriteId);
+    GEM_VIRTUAL_DRAW GEMSprite* getSprite(byte spriteId) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void drawSprite(uint8_t x, uint8_t y, byte spriteId, uint8_t mode, GEMItem* menuItem = nullptr, bool withInsetOffset = true) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemString(const char* str, byte num, byte startPos = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemTitle(const char* str, int offset = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemValue(const char* str, int offset = 0, byte startPos = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW char* formatMenuItemValue(GEMItem* menuItemTmp, byte linkedType, char* valueStringTmp) GEM_FINAL_DRAW;  // Format value of the associated variable (of the supplied type) of the menu item
+    GEM_VIRTUAL_DRAW void printMenuItemFull(const char* str, int offset = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void drawMenuItemValue(GEMItem* menuItemTmp, byte yDraw) GEM_FINAL_DRAW;  // Draw value of the associated variable of the menu item (in place of the value of the current row)
+    GEM_VIRTUAL_DRAW byte getMenuItemInsetOffset() GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte getCurrentItemTopOffset(bool withInsetOffset = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte calculateSpriteOverlap(byte spriteId) GEM_FINAL_DRAW;
     GEM_VIRTUAL void printMenuItems();
     GEM_VIRTUAL void drawMenuPointer();
     GEM_VIRTUAL void drawScrollbar();
-
-    /* MENU ITEMS NAVIGATION */
-
-    GEM_VIRTUAL void nextMenuItem();
-    GEM_VIRTUAL void prevMenuItem();
-    GEM_VIRTUAL void menuItemSelect();
+    bool _deferredDrawing = false;
+    byte _maxFrameRate = 0;
+    GEMPage* _drawnMenuPage = nullptr;                      // Menu page that was last drawn with GEM::drawMenu()
+    GEMPage* _spritesMenuPage = nullptr;                    // Menu page which sprites are loaded into RAM of the SparkFun Graphic LCD Serial Backpack
+    GEMIndex _drawnItemNum = 0;                             // Menu item which pointer is drawn on screen
+    unsigned long _lastFrameTime = 0;
+    void flushPendingDraw();
 
     /* VALUE EDIT */
 
-    bool _editValueMode;
-    byte _editValueType;
-    byte _editValueLength;
-    byte _editValueCursorPosition;
-    byte _editValueVirtualCursorPosition;
-    char _valueString[GEM_STR_LEN];
-    int _valueSelectNum;
-    GEM_VIRTUAL void enterEditValueMode();
-    GEM_VIRTUAL void checkboxToggle();
+    GEM_VIRTUAL void drawCheckbox();                        // Draw toggled checkbox of the current menu item (in place of the previous one)
     GEM_VIRTUAL void clearValueVisibleRange();
-    GEM_VIRTUAL void initEditValueCursor();
-    GEM_VIRTUAL void nextEditValueCursorPosition();
-    GEM_VIRTUAL void prevEditValueCursorPosition();
     GEM_VIRTUAL void drawEditValueCursor();
-    GEM_VIRTUAL void nextEditValueDigit();
-    GEM_VIRTUAL void prevEditValueDigit();
+    GEM_VIRTUAL void moveEditValueCursor(byte dirty);       // Move edit cursor on screen (scrolling the value if necessary) and draw changed digit
+    GEM_VIRTUAL void drawEditValueSelect();
+    GEM_VIRTUAL void drawEditValue();                       // Draw value being edited over the row of the current menu item (used when the whole menu is redrawn in edit mode)
+
+    #ifdef GEM_ENABLE_ADVANCED_MODE
+
+    /* MENU ITEMS NAVIGATION AND VALUE EDIT (moved to GEMController) */
+
+    // Forward to the controller and draw the result. Declared final, so that overrides written for the earlier versions of GEM fail to compile
+    // instead of never being called: override these methods in a class derived from GEMController instead (see setController())
+    virtual void nextMenuItem() final;
+    virtual void prevMenuItem() final;
+    virtual void menuItemSelect() final;
+    virtual void enterEditValueMode() final;
+    virtual void checkboxToggle() final;
+    virtual void initEditValueCursor() final;
+    virtual void nextEditValueCursorPosition() final;
+    virtual void prevEditValueCursorPosition() final;
+    virtual void nextEditValueDigit() final;
+    virtual void prevEditValueDigit() final;
     #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-    GEM_VIRTUAL void callPreviewCallback(bool reset = false);
+    virtual void callPreviewCallback(bool reset = false) final;
     #endif
-    GEM_VIRTUAL void drawEditValueDigit(byte code);
-    GEM_VIRTUAL void nextEditValueSelect();
-    GEM_VIRTUAL void prevEditValueSelect();
+    virtual void drawEditValueDigit(byte code) final;
+    virtual void nextEditValueSelect() final;
+    virtual void prevEditValueSelect() final;
     #ifdef GEM_SUPPORT_SPINNER
-    GEM_VIRTUAL void nextEditValueSpinner();
-    GEM_VIRTUAL void prevEditValueSpinner();
+    virtual void nextEditValueSpinner() final;
+    virtual void prevEditValueSpinner() final;
+    #endif
+    virtual void saveEditValue() final;
+    virtual void cancelEditValue() final;
+    virtual void resetEditValueState() final;
+    virtual void exitEditValue() final;
     #endif
-    GEM_VIRTUAL void drawEditValueSelect();
-    GEM_VIRTUAL void saveEditValue();
-    GEM_VIRTUAL void cancelEditValue();
-    GEM_VIRTUAL void resetEditValueState();
-    GEM_VIRTUAL void exitEditValue();
-    char* trimString(char* str);
 
     /* KEY DETECTION */
 
     byte _currentKey;
     void dispatchKeyPress();
+    #ifdef GEM_ENABLE_KEY_QUEUE
+    GEMKeyQueue _keyQueue;
+    #endif
 };
 
 #endif
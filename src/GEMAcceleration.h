@@ -0,0 +1,53 @@
+/*
+  GEMAcceleration - acceleration curve of the value edit on rapid key presses for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef HEADER_GEMACCELERATION
+#define HEADER_GEMACCELERATION
+
+#include <Arduino.h>
+
+// Declaration of GEMAcceleration type: series of key presses that follow each other within 'interval' ms is treated as rapid
+// (e.g. fast rotation of the encoder or held key), and each 'pressesPerStage' key presses of the series the step of the
+// edit is multiplied by 'factor' once again, up to 'maxStage' times (e.g. { 150, 10, 10, 2 } results in steps x1, x10, x100)
+struct GEMAcceleration {
+  uint16_t interval;        // Max interval between key presses of the rapid series (ms), 0 disables acceleration
+  byte pressesPerStage;     // Count of key presses of the series required to advance to the next stage of acceleration
+  byte factor;              // Multiplier of the step applied at each stage
+  byte maxStage;            // Max stage of acceleration
+};
+
+#endif
@@ -49,5 +49,18 @@ struct GEMAppearance {
   // alongside brace-enclosed initizilzer list due to lack of the full C++ Standard Library (STL),
   // so explicit initalization of sprites member is recommended when creating instance of GEMAppearance object
 };
+
+// Declaration of GEMLayout type
+// Layout of the menu derived from the current GEMAppearance and from the display and font metrics. Recalculated by GEM
+// on changes of appearance, fonts or current menu page (and at the start of each frame), so that none of these values
+// are recalculated for each menu item drawn
+struct GEMLayout {
+  GEMAppearance* appearance = nullptr;  // Appearance the layout is calculated for
+  byte menuItemsPerScreen = 0;
+  byte menuItemFontSize = 0;
+  byte menuItemTitleLength = 0;
+  byte menuItemValueLength = 0;
+  byte menuItemInsetOffset = 0;
+};
   
 #endif
@@ -0,0 +1,802 @@
+/*
+  GEMController - class that handles navigation through the menu and edit of the values of menu items
+  (independently of the display library used), marking views of the menu for redraw.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GEMController.h"
+#include "GEMFormat.h"
+
+// Macro constants (aliases) for some of the ASCII character codes
+#define GEM_CHAR_CODE_9 57
+#define GEM_CHAR_CODE_0 48
+#define GEM_CHAR_CODE_MINUS 45
+#define GEM_CHAR_CODE_DOT 46
+#define GEM_CHAR_CODE_SPACE 32
+#define GEM_CHAR_CODE_UNDERSCORE 95
+#define GEM_CHAR_CODE_LINE 124
+#define GEM_CHAR_CODE_TILDA 126
+#define GEM_CHAR_CODE_BANG 33
+#define GEM_CHAR_CODE_a 97
+#define GEM_CHAR_CODE_ACCENT 96
+
+/*
+// WIP for Cyrillic values support
+#define GEM_CHAR_CODE_CYR_YO 1025
+#define GEM_CHAR_CODE_CYR_A 1040
+#define GEM_CHAR_CODE_CYR_E 1045
+#define GEM_CHAR_CODE_CYR_E_SM 1077
+#define GEM_CHAR_CODE_CYR_YA_SM 1103
+#define GEM_CHAR_CODE_CYR_YO_SM 1105
+*/
+
+void GEMView::updateEditValueCursor(byte virtualCursorPosition, byte length) {
+  if (dirty & GEM_DIRTY_EDIT) {
+    // Value is drawn from its start when edit mode is entered
+    editValueCursorPosition = 0;
+    editValueVirtualCursorPosition = 0;
+  }
+  byte offset = editValueVirtualCursorPosition - editValueCursorPosition;
+  if (virtualCursorPosition < offset) {
+    offset = virtualCursorPosition;
+  } else if (virtualCursorPosition >= offset + length) {
+    offset = virtualCursorPosition - length + 1;
+  }
+  editValueVirtualCursorPosition = virtualCursorPosition;
+  editValueCursorPosition = virtualCursorPosition - offset;
+}
+
+bool GEMView::areMenuItemsDirty(GEMIndex first, byte count) {
+  return (dirty & GEM_DIRTY_ITEMS) && dirtyItemFirst < first + count && dirtyItemLast >= first;
+}
+
+GEMController::GEMController() {
+  editValueMode = false;
+  memset(valueString, '\0', GEM_STR_LEN - 1);
+  valueSelectNum = -1;
+}
+
+void GEMController::attachView(GEMView& view) {
+  view.viewNext = _view;
+  _view = &view;
+}
+
+void GEMController::detachView(GEMView& view) {
+  for (GEMView** viewTmp = &_view; *viewTmp != nullptr; viewTmp = &(*viewTmp)->viewNext) {
+    if (*viewTmp == &view) {
+      *viewTmp = view.viewNext;
+      view.viewNext = nullptr;
+      break;
+    }
+  }
+}
+
+void GEMController::markDirty(byte flags) {
+  for (GEMView* viewTmp = _view; viewTmp != nullptr; viewTmp = viewTmp->viewNext) {
+    viewTmp->dirty |= flags;
+  }
+}
+
+void GEMController::invalidateMenuItem(GEMItem& menuItem, bool following) {
+  if (menuPageCurrent != nullptr && menuItem.parentPage == menuPageCurrent) {
+    // Position of the menu item among visible ones (or position it occupied before it was hidden)
+    int menuItemNum = menuPageCurrent->getMenuItemNum(menuItem);
+    if (menuItemNum < 0 && menuPageCurrent->isProviderItem(menuItem)) {
+      // Scratch menu item that currently doesn't materialize any of the items supplied by provider
+      return;
+    } else if (menuItemNum < 0) {
+      menuItemNum = 0;
+      GEMItem* menuItemTmp = menuPageCurrent->getMenuItem(0, true);
+      while (menuItemTmp != nullptr && menuItemTmp != &menuItem) {
+        if (!menuItemTmp->flags.hidden) {
+          menuItemNum++;
+        }
+        menuItemTmp = menuItemTmp->getMenuItemNext(true);
+      }
+    }
+    markItemsDirty(menuItemNum, following ? GEM_LAST_POS : menuItemNum);
+  }
+}
+
+void GEMController::markItemsDirty(GEMIndex first, GEMIndex last) {
+  for (GEMView* viewTmp = _view; viewTmp != nullptr; viewTmp = viewTmp->viewNext) {
+    if (!(viewTmp->dirty & GEM_DIRTY_ITEMS)) {
+      viewTmp->dirtyItemFirst = first;
+      viewTmp->dirtyItemLast = last;
+    } else {
+      // Ranges are merged (along with the menu items in between)
+      if (first < viewTmp->dirtyItemFirst) {
+        viewTmp->dirtyItemFirst = first;
+      }
+      if (last > viewTmp->dirtyItemLast) {
+        viewTmp->dirtyItemLast = last;
+      }
+    }
+    viewTmp->dirty |= GEM_DIRTY_ITEMS;
+  }
+}
+
+//====================== MENU ITEMS NAVIGATION
+
+void GEMController::setMenuPageCurrent(GEMPage& menuPageCurrent_) {
+  menuPageCurrent = &menuPageCurrent_;
+  markDirty(GEM_DIRTY_MENU);
+}
+
+void GEMController::nextMenuItem() {
+  if (menuPageCurrent->itemsCount > 0) {
+    if (menuPageCurrent->currentItemNum == menuPageCurrent->itemsCount-1) {
+      menuPageCurrent->currentItemNum = 0;
+    } else {
+      menuPageCurrent->currentItemNum++;
+    }
+    markDirty(GEM_DIRTY_POINTER);
+  }
+}
+
+void GEMController::prevMenuItem() {
+  if (menuPageCurrent->itemsCount > 0) {
+    if (menuPageCurrent->currentItemNum == 0) {
+      menuPageCurrent->currentItemNum = menuPageCurrent->itemsCount-1;
+    } else {
+      menuPageCurrent->currentItemNum--;
+    }
+    markDirty(GEM_DIRTY_POINTER);
+  }
+}
+
+void GEMController::goToMenuItem(GEMIndex index) {
+  if (menuPageCurrent != nullptr && !editValueMode && index < menuPageCurrent->itemsCount && index != menuPageCurrent->currentItemNum) {
+    moveMenuPointer(index);
+  }
+}
+
+void GEMController::goToMenuItem(GEMItem& menuItem) {
+  if (menuPageCurrent != nullptr && menuItem.parentPage == menuPageCurrent) {
+    int menuItemNum = menuPageCurrent->getMenuItemNum(menuItem);
+    if (menuItemNum >= 0) {
+      goToMenuItem((GEMIndex)menuItemNum);
+    }
+  }
+}
+
+void GEMController::goToFirstMenuItem() {
+  goToMenuItem((GEMIndex)0);
+}
+
+void GEMController::goToLastMenuItem() {
+  if (menuPageCurrent != nullptr && menuPageCurrent->itemsCount > 0) {
+    goToMenuItem((GEMIndex)(menuPageCurrent->itemsCount - 1));
+  }
+}
+
+void GEMController::goToPrevScreen(byte menuItemsPerScreen) {
+  if (menuPageCurrent != nullptr) {
+    goToMenuItem((GEMIndex)(menuPageCurrent->currentItemNum > menuItemsPerScreen ? menuPageCurrent->currentItemNum - menuItemsPerScreen : 0));
+  }
+}
+
+void GEMController::goToNextScreen(byte menuItemsPerScreen) {
+  if (menuPageCurrent != nullptr && menuPageCurrent->itemsCount > 0) {
+    GEMIndex lastItemNum = menuPageCurrent->itemsCount - 1;
+    goToMenuItem((GEMIndex)(lastItemNum - menuPageCurrent->currentItemNum > menuItemsPerScreen ? menuPageCurrent->currentItemNum + menuItemsPerScreen : lastItemNum));
+  }
+}
+
+void GEMController::goToPrevInteractiveMenuItem() {
+  if (menuPageCurrent != nullptr) {
+    // Items are linked in forward direction only, so walk the page once remembering the last interactive menu item
+    // preceding the current one (or, for wrapping around, the last interactive one following it)
+    GEMIndex currentItemNum = menuPageCurrent->currentItemNum;
+    int menuItemNumPrev = -1;
+    int menuItemNumLast = -1;
+    GEMItem* menuItemTmp = menuPageCurrent->getMenuItem(0);
+    for (GEMIndex i = 0; i < menuPageCurrent->itemsCount && menuItemTmp != nullptr; i++) {
+      if (i != currentItemNum && !menuItemTmp->flags.readonly && menuItemTmp->type != GEM_ITEM_LABEL) {
+        if (i < currentItemNum) {
+          menuItemNumPrev = i;
+        } else {
+          menuItemNumLast = i;
+        }
+      }
+      menuItemTmp = menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    }
+    if (menuItemNumPrev >= 0) {
+      goToMenuItem((GEMIndex)menuItemNumPrev);
+    } else if (menuItemNumLast >= 0) {
+      goToMenuItem((GEMIndex)menuItemNumLast);
+    }
+  }
+}
+
+void GEMController::goToNextInteractiveMenuItem() {
+  if (menuPageCurrent != nullptr) {
+    GEMIndex menuItemNum = menuPageCurrent->currentItemNum;
+    GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+    for (GEMIndex i = 1; i < menuPageCurrent->itemsCount && menuItemTmp != nullptr; i++) {
+      if (menuItemNum + 1 < menuPageCurrent->itemsCount) {
+        menuItemNum++;
+        menuItemTmp = menuPageCurrent->getMenuItemNext(*menuItemTmp);
+      } else {
+        menuItemNum = 0;
+        menuItemTmp = menuPageCurrent->getMenuItem(0);
+      }
+      if (menuItemTmp != nullptr && !menuItemTmp->flags.readonly && menuItemTmp->type != GEM_ITEM_LABEL) {
+        goToMenuItem(menuItemNum);
+        break;
+      }
+    }
+  }
+}
+
+void GEMController::moveMenuPointer(GEMIndex menuItemNum) {
+  menuPageCurrent->currentItemNum = menuItemNum;
+  markDirty(GEM_DIRTY_POINTER);
+}
+
+void GEMController::menuItemSelect() {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  if (menuItemTmp != nullptr) {
+    switch (menuItemTmp->type) {
+      case GEM_ITEM_VAL:
+        if (!menuItemTmp->flags.readonly) {
+          enterEditValueMode();
+        }
+        break;
+      case GEM_ITEM_LINK:
+        if (!menuItemTmp->flags.readonly) {
+          menuPageCurrent = menuItemTmp->linkedPage;
+          markDirty(GEM_DIRTY_MENU);
+        }
+        break;
+      case GEM_ITEM_BACK:
+        menuPageCurrent->currentItemNum = (menuPageCurrent->itemsCount > 1) ? 1 : 0;
+        menuPageCurrent = menuItemTmp->linkedPage;
+        markDirty(GEM_DIRTY_MENU);
+        break;
+      case GEM_ITEM_BUTTON:
+        if (!menuItemTmp->flags.readonly) {
+          if (menuItemTmp->flags.callbackWithArgs) {
+            menuItemTmp->callbackActionArg(menuItemTmp->getCallbackData());
+          } else {
+            menuItemTmp->callbackAction();
+          }
+        }
+        break;
+    }
+  }
+}
+
+//====================== VALUE EDIT
+
+void GEMController::enterEditValueMode() {
+  editValueMode = true;
+
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  editValueType = menuItemTmp->linkedType;
+  // String representation of the value is edited (formatting is skipped for bool, select and spinner)
+  GEMFormat::formatValue(menuItemTmp->linkedVariable, editValueType, menuItemTmp->precision, valueString);
+  switch (editValueType) {
+    case GEM_VAL_INTEGER:
+      editValueLength = 6;
+      break;
+    case GEM_VAL_BYTE:
+      editValueLength = 3;
+      break;
+    case GEM_VAL_BOOL:
+      checkboxToggle();
+      return;
+    case GEM_VAL_SELECT:
+      valueSelectNum = menuItemTmp->getSelectedOptionNum();
+      break;
+    #ifdef GEM_SUPPORT_SPINNER
+    case GEM_VAL_SPINNER:
+      valueSelectNum = menuItemTmp->spinner->getSelectedOptionNum(menuItemTmp->linkedVariable);
+      break;
+    #endif
+    default:
+      // char[17], GEMFixed, float and double values
+      editValueLength = GEM_STR_LEN - 1;
+      break;
+  }
+  editValueVirtualCursorPosition = 0;
+  markDirty(GEM_DIRTY_EDIT);
+}
+
+void GEMController::checkboxToggle() {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  bool checkboxValue = *(bool*)menuItemTmp->linkedVariable;
+  *(bool*)menuItemTmp->linkedVariable = !checkboxValue;
+  if (menuItemTmp->callbackAction != nullptr) {
+    callMenuItemCallback(menuItemTmp);
+  } else {
+    editValueMode = false;
+    markDirty(GEM_DIRTY_VALUE);
+  }
+}
+
+void GEMController::callMenuItemCallback(GEMItem* menuItem) {
+  resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
+  if (menuItem->flags.callbackWithArgs) {
+    menuItem->callbackActionArg(menuItem->getCallbackData());
+  } else {
+    menuItem->callbackAction();
+  }
+  if (!editValueMode) { // Edge case e.g. when edit mode was activated from inside callback (e.g. on another menu item)
+    markDirty(GEM_DIRTY_MENU);
+  }
+}
+
+void GEMController::nextEditValueCursorPosition() {
+  if ((editValueVirtualCursorPosition != editValueLength - 1) && (valueString[editValueVirtualCursorPosition] != '\0')) {
+    editValueVirtualCursorPosition++;
+    markDirty(GEM_DIRTY_CURSOR);
+  }
+}
+
+void GEMController::prevEditValueCursorPosition() {
+  if (editValueVirtualCursorPosition != 0) {
+    editValueVirtualCursorPosition--;
+    markDirty(GEM_DIRTY_CURSOR);
+  }
+}
+
+void GEMController::nextEditValueDigit() {
+  byte code = (byte)valueString[editValueVirtualCursorPosition];
+  int steps = getAccelerationSteps((editValueType == GEM_VAL_CHAR) ? _charAcceleration : _digitAcceleration, 1);
+  code = nextEditValueCode(code);
+  for (int i = 1; i < steps; i++) {
+    byte codeNext = nextEditValueCode(code);
+    if (editValueType != GEM_VAL_CHAR && (codeNext < GEM_CHAR_CODE_0 || codeNext > GEM_CHAR_CODE_9)) {
+      break; // Accelerated step of the digit stops at 9 (only the next key press leaves the range of digits)
+    }
+    code = codeNext;
+  }
+  setEditValueDigit(code);
+}
+
+byte GEMController::nextEditValueCode(byte code) {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  if (editValueType == GEM_VAL_CHAR) {
+    if (menuItemTmp->flags.adjustedAsciiOrder) {
+      switch (code) {
+        case 0:
+          code = GEM_CHAR_CODE_a;
+          break;
+        case GEM_CHAR_CODE_SPACE:
+          code = GEM_CHAR_CODE_a;
+          break;
+        case GEM_CHAR_CODE_ACCENT:
+          code = GEM_CHAR_CODE_SPACE;
+          break;
+        case GEM_CHAR_CODE_TILDA:
+          code = GEM_CHAR_CODE_BANG;
+          break;
+        default:
+          code++;
+          break;
+      }
+    } else {
+      switch (code) {
+        case 0:
+          code = GEM_CHAR_CODE_SPACE;
+          break;
+        case GEM_CHAR_CODE_TILDA:
+          code = GEM_CHAR_CODE_SPACE;
+          break;
+        /*
+        // WIP for Cyrillic values support
+        case GEM_CHAR_CODE_TILDA:
+          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_A : GEM_CHAR_CODE_SPACE;
+          break;
+        case GEM_CHAR_CODE_CYR_YA_SM:
+          code = GEM_CHAR_CODE_SPACE;
+          break;
+        case GEM_CHAR_CODE_CYR_E:
+          code = GEM_CHAR_CODE_CYR_YO;
+          break;
+        case GEM_CHAR_CODE_CYR_YO:
+          code = GEM_CHAR_CODE_CYR_E + 1;
+          break;
+        case GEM_CHAR_CODE_CYR_E_SM:
+          code = GEM_CHAR_CODE_CYR_YO_SM;
+          break;
+        case GEM_CHAR_CODE_CYR_YO_SM:
+          code = GEM_CHAR_CODE_CYR_E_SM + 1;
+          break;
+        */
+        default:
+          code++;
+          break;
+      }
+    }
+    if (code == GEM_CHAR_CODE_LINE && _skipLineChar) {
+      code++;
+    }
+  } else {
+    switch (code) {
+      case 0:
+        code = GEM_CHAR_CODE_0;
+        break;
+      case GEM_CHAR_CODE_9:
+        code = (editValueVirtualCursorPosition == 0 && (editValueType == GEM_VAL_INTEGER || editValueType == GEM_VAL_FLOAT || editValueType == GEM_VAL_DOUBLE || editValueType == GEM_VAL_FIXED)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_SPACE;
+        break;
+      case GEM_CHAR_CODE_MINUS:
+        code = GEM_CHAR_CODE_SPACE;
+        break;
+      case GEM_CHAR_CODE_SPACE:
+        code = (editValueVirtualCursorPosition != 0 && (editValueType == GEM_VAL_FLOAT || editValueType == GEM_VAL_DOUBLE || editValueType == GEM_VAL_FIXED)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_0;
+        break;
+      case GEM_CHAR_CODE_DOT:
+        code = GEM_CHAR_CODE_0;
+        break;
+      default:
+        code++;
+        break;
+    }
+  }
+  return code;
+}
+
+void GEMController::prevEditValueDigit() {
+  byte code = (byte)valueString[editValueVirtualCursorPosition];
+  int steps = getAccelerationSteps((editValueType == GEM_VAL_CHAR) ? _charAcceleration : _digitAcceleration, -1);
+  code = prevEditValueCode(code);
+  for (int i = 1; i < steps; i++) {
+    byte codeNext = prevEditValueCode(code);
+    if (editValueType != GEM_VAL_CHAR && (codeNext < GEM_CHAR_CODE_0 || codeNext > GEM_CHAR_CODE_9)) {
+      break; // Accelerated step of the digit stops at 0 (only the next key press leaves the range of digits)
+    }
+    code = codeNext;
+  }
+  setEditValueDigit(code);
+}
+
+byte GEMController::prevEditValueCode(byte code) {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  if (editValueType == GEM_VAL_CHAR) {
+    if (menuItemTmp->flags.adjustedAsciiOrder) {
+      switch (code) {
+        case 0:
+          code = GEM_CHAR_CODE_ACCENT;
+          break;
+        case GEM_CHAR_CODE_BANG:
+          code = GEM_CHAR_CODE_TILDA;
+          break;
+        case GEM_CHAR_CODE_a:
+          code = GEM_CHAR_CODE_SPACE;
+          break;
+        case GEM_CHAR_CODE_SPACE:
+          code = GEM_CHAR_CODE_ACCENT;
+          break;
+        default:
+          code--;
+          break;
+      }
+    } else {
+      switch (code) {
+        case 0:
+          code = GEM_CHAR_CODE_TILDA;
+          break;
+        case GEM_CHAR_CODE_SPACE:
+          code = GEM_CHAR_CODE_TILDA;
+          break;
+        /*
+        // WIP for Cyrillic values support
+        case 0:
+          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_YA_SM : GEM_CHAR_CODE_TILDA;
+          break;
+        case GEM_CHAR_CODE_SPACE:
+          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_YA_SM : GEM_CHAR_CODE_TILDA;
+          break;
+        case GEM_CHAR_CODE_CYR_A:
+          code = GEM_CHAR_CODE_TILDA;
+          break;
+        case GEM_CHAR_CODE_CYR_E + 1:
+          code = GEM_CHAR_CODE_CYR_YO;
+          break;
+        case GEM_CHAR_CODE_CYR_YO:
+          code = GEM_CHAR_CODE_CYR_E;
+          break;
+        case GEM_CHAR_CODE_CYR_E_SM + 1:
+          code = GEM_CHAR_CODE_CYR_YO_SM;
+          break;
+        case GEM_CHAR_CODE_CYR_YO_SM:
+          code = GEM_CHAR_CODE_CYR_E_SM;
+          break;
+        */
+        default:
+          code--;
+          break;
+      }
+    }
+    if (code == GEM_CHAR_CODE_LINE && _skipLineChar) {
+      code--;
+    }
+  } else {
+    switch (code) {
+      case 0:
+        code = (editValueVirtualCursorPosition == 0 && (editValueType == GEM_VAL_INTEGER || editValueType == GEM_VAL_FLOAT || editValueType == GEM_VAL_DOUBLE || editValueType == GEM_VAL_FIXED)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
+        break;
+      case GEM_CHAR_CODE_MINUS:
+        code = GEM_CHAR_CODE_9;
+        break;
+      case GEM_CHAR_CODE_0:
+        code = (editValueVirtualCursorPosition != 0 && (editValueType == GEM_VAL_FLOAT || editValueType == GEM_VAL_DOUBLE || editValueType == GEM_VAL_FIXED)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_SPACE;
+        break;
+      case GEM_CHAR_CODE_SPACE:
+        code = (editValueVirtualCursorPosition == 0 && (editValueType == GEM_VAL_INTEGER || editValueType == GEM_VAL_FLOAT || editValueType == GEM_VAL_DOUBLE || editValueType == GEM_VAL_FIXED)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
+        break;
+      case GEM_CHAR_CODE_DOT:
+        code = GEM_CHAR_CODE_SPACE;
+        break;
+      default:
+        code--;
+        break;
+    }
+  }
+  return code;
+}
+
+int GEMController::getAccelerationSteps(GEMAcceleration& acceleration, char direction) {
+  unsigned long now = millis();
+  if (acceleration.interval > 0 && direction == _rapidKeyDirection && now - _rapidKeyTime <= acceleration.interval) {
+    if (_rapidKeyCount < 255) {
+      _rapidKeyCount++;
+    }
+  } else {
+    _rapidKeyCount = 0;
+  }
+  _rapidKeyDirection = direction;
+  _rapidKeyTime = now;
+  int steps = 1;
+  if (acceleration.pressesPerStage > 0 && acceleration.factor > 1) {
+    byte stage = _rapidKeyCount / acceleration.pressesPerStage;
+    for (byte i = 0; i < stage && i < acceleration.maxStage && steps <= 0x7FFF / acceleration.factor; i++) {
+      steps *= acceleration.factor;
+    }
+  }
+  return steps;
+}
+
+#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+void GEMController::callPreviewCallback(bool reset) {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  if (menuItemTmp->previewCallbackAction != nullptr) {
+    menuItemTmp->previewCallbackAction(menuItemTmp->getPreviewCallbackData(reset ? nullptr : valueString, valueSelectNum));
+  }
+}
+#endif
+
+void GEMController::setEditValueDigit(byte code) {
+  valueString[editValueVirtualCursorPosition] = (char)code;
+  markDirty(GEM_DIRTY_VALUE);
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback();
+  #endif
+}
+
+void GEMController::nextEditValueSelect() {
+  GEMSelect* select = menuPageCurrent->getCurrentMenuItem()->select;
+  if (valueSelectNum+1 < select->getLength()) {
+    valueSelectNum++;
+  } else if (select->getLoop()) {
+    valueSelectNum = 0;
+  }
+  markDirty(GEM_DIRTY_VALUE);
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback();
+  #endif
+}
+
+void GEMController::prevEditValueSelect() {
+  GEMSelect* select = menuPageCurrent->getCurrentMenuItem()->select;
+  if (valueSelectNum > 0) {
+    valueSelectNum--;
+  } else if (select->getLoop()) {
+    valueSelectNum = select->getLength() - 1;
+  }
+  markDirty(GEM_DIRTY_VALUE);
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback();
+  #endif
+}
+
+#ifdef GEM_SUPPORT_SPINNER
+void GEMController::nextEditValueSpinner() {
+  GEMSpinner* spinner = menuPageCurrent->getCurrentMenuItem()->spinner;
+  int steps = getAccelerationSteps(spinner->_acceleration, 1);
+  if (valueSelectNum + steps < spinner->getLength()) {
+    valueSelectNum += steps;
+  } else if (valueSelectNum+1 < spinner->getLength()) {
+    valueSelectNum = spinner->getLength() - 1; // Accelerated step stops at the boundary before looping
+  } else if (spinner->getLoop()) {
+    valueSelectNum = 0;
+  }
+  markDirty(GEM_DIRTY_VALUE);
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback();
+  #endif
+}
+
+void GEMController::prevEditValueSpinner() {
+  GEMSpinner* spinner = menuPageCurrent->getCurrentMenuItem()->spinner;
+  int steps = getAccelerationSteps(spinner->_acceleration, -1);
+  if (valueSelectNum - steps >= 0) {
+    valueSelectNum -= steps;
+  } else if (valueSelectNum > 0) {
+    valueSelectNum = 0; // Accelerated step stops at the boundary before looping
+  } else if (spinner->getLoop()) {
+    valueSelectNum = spinner->getLength() - 1;
+  }
+  markDirty(GEM_DIRTY_VALUE);
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback();
+  #endif
+}
+#endif
+
+void GEMController::saveEditValue() {
+  GEMItem* menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+  menuItemTmp->saveEditValue(valueString, valueSelectNum);
+  if (menuItemTmp->callbackAction != nullptr) {
+    callMenuItemCallback(menuItemTmp);
+  } else {
+    exitEditValue();
+  }
+}
+
+void GEMController::cancelEditValue() {
+  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+  callPreviewCallback(true);
+  #endif
+  exitEditValue();
+}
+
+void GEMController::resetEditValueState() {
+  memset(valueString, '\0', GEM_STR_LEN - 1);
+  valueSelectNum = -1;
+  editValueMode = false;
+  _rapidKeyDirection = 0;
+}
+
+void GEMController::exitEditValue() {
+  resetEditValueState();
+  markDirty(GEM_DIRTY_EDIT);
+}
+
+//====================== KEY DETECTION
+
+void GEMController::dispatchKeyPress(byte keyCode, byte menuItemsPerScreen) {
+  if (editValueMode) {
+    switch (keyCode) {
+      case GEM_CONTROLLER_KEY_UP:
+        if (editValueType == GEM_VAL_SELECT) {
+          prevEditValueSelect();
+        #ifdef GEM_SUPPORT_SPINNER
+        } else if (editValueType == GEM_VAL_SPINNER) {
+          if (_invertKeysDuringEdit) {
+            prevEditValueSpinner();
+          } else {
+            nextEditValueSpinner();
+          }
+        #endif
+        } else if (_invertKeysDuringEdit) {
+          prevEditValueDigit();
+        } else {
+          nextEditValueDigit();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_RIGHT:
+        if (editValueType != GEM_VAL_SELECT && editValueType != GEM_VAL_SPINNER) {
+          nextEditValueCursorPosition();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_DOWN:
+        if (editValueType == GEM_VAL_SELECT) {
+          nextEditValueSelect();
+        #ifdef GEM_SUPPORT_SPINNER
+        } else if (editValueType == GEM_VAL_SPINNER) {
+          if (_invertKeysDuringEdit) {
+            nextEditValueSpinner();
+          } else {
+            prevEditValueSpinner();
+          }
+        #endif
+        } else if (_invertKeysDuringEdit) {
+          nextEditValueDigit();
+        } else {
+          prevEditValueDigit();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_LEFT:
+        if (editValueType != GEM_VAL_SELECT && editValueType != GEM_VAL_SPINNER) {
+          prevEditValueCursorPosition();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_CANCEL:
+        cancelEditValue();
+        break;
+      case GEM_CONTROLLER_KEY_OK:
+        saveEditValue();
+        break;
+    }
+  } else {
+    GEMItem* menuItemTmp;
+    switch (keyCode) {
+      case GEM_CONTROLLER_KEY_UP:
+        prevMenuItem();
+        break;
+      case GEM_CONTROLLER_KEY_RIGHT:
+        menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+        if (menuItemTmp != nullptr && (menuItemTmp->type == GEM_ITEM_LINK || menuItemTmp->type == GEM_ITEM_BUTTON)) {
+          menuItemSelect();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_DOWN:
+        nextMenuItem();
+        break;
+      case GEM_CONTROLLER_KEY_LEFT:
+        menuItemTmp = menuPageCurrent->getCurrentMenuItem();
+        if (menuItemTmp != nullptr && menuItemTmp->type == GEM_ITEM_BACK) {
+          menuItemSelect();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_CANCEL:
+        if (menuPageCurrent->getMenuItem(0) != nullptr && menuPageCurrent->getMenuItem(0)->type == GEM_ITEM_BACK) {
+          menuPageCurrent->currentItemNum = 0;
+          menuItemSelect();
+        } else if (menuPageCurrent->exitAction != nullptr) {
+          moveMenuPointer(0);
+          menuPageCurrent->exitAction();
+        }
+        break;
+      case GEM_CONTROLLER_KEY_OK:
+        menuItemSelect();
+        break;
+      case GEM_CONTROLLER_KEY_PAGE_UP:
+        goToPrevScreen(menuItemsPerScreen);
+        break;
+      case GEM_CONTROLLER_KEY_PAGE_DOWN:
+        goToNextScreen(menuItemsPerScreen);
+        break;
+      case GEM_CONTROLLER_KEY_HOME:
+        goToFirstMenuItem();
+        break;
+      case GEM_CONTROLLER_KEY_END:
+        goToLastMenuItem();
+        break;
+    }
+  }
+}
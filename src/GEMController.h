@@ -0,0 +1,177 @@
+/*
+  GEMController - class that handles navigation through the menu and edit of the values of menu items
+  (independently of the display library used), marking views of the menu for redraw. Single controller can be shared
+  by several menu objects that drive different displays.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEADER_GEMCONTROLLER
+#define HEADER_GEMCONTROLLER
+
+#include <Arduino.h>
+#include "config.h"
+#include "GEMPage.h"
+#include "GEMSelect.h"
+#ifdef GEM_SUPPORT_SPINNER
+#include "GEMSpinner.h"
+#endif
+#include "GEMAcceleration.h"
+#include "constants.h"
+
+// Macro constants (aliases) for the keys handled by GEMController::dispatchKeyPress() (key codes of GEM and GEM_adafruit_gfx,
+// key codes of GEM_u8g2 are translated to these before being dispatched)
+#define GEM_CONTROLLER_KEY_NONE 0
+#define GEM_CONTROLLER_KEY_UP 1
+#define GEM_CONTROLLER_KEY_RIGHT 2
+#define GEM_CONTROLLER_KEY_DOWN 3
+#define GEM_CONTROLLER_KEY_LEFT 4
+#define GEM_CONTROLLER_KEY_CANCEL 5
+#define GEM_CONTROLLER_KEY_OK 6
+#define GEM_CONTROLLER_KEY_PAGE_UP 7
+#define GEM_CONTROLLER_KEY_PAGE_DOWN 8
+#define GEM_CONTROLLER_KEY_HOME 9
+#define GEM_CONTROLLER_KEY_END 10
+
+// Macro constants (aliases) for the parts of the menu that should be redrawn by the view (combined as bit flags)
+#define GEM_DIRTY_MENU 1     // Whole menu (e.g. menu page changed or callback of menu item was called)
+#define GEM_DIRTY_POINTER 2  // Menu pointer moved to another menu item
+#define GEM_DIRTY_EDIT 4     // Edit mode was entered or exited
+#define GEM_DIRTY_VALUE 8    // Value of the current menu item changed (digit or option being edited, or toggled checkbox)
+#define GEM_DIRTY_CURSOR 16  // Edit cursor moved to another digit
+#define GEM_DIRTY_ITEMS 32   // Menu items in range [dirtyItemFirst, dirtyItemLast] of the current menu page changed (see GEMController::invalidateMenuItem())
+
+// Declaration of GEMView type: what is drawn on the display attached to the controller
+struct GEMView {
+  GEMView* viewNext = nullptr;                  // Next view attached to the same controller
+  byte dirty = 0;                               // Parts of the menu changed since they were drawn (GEM_DIRTY_* flags)
+  GEMIndex dirtyItemFirst = 0;                  // Range of the changed menu items (valid if GEM_DIRTY_ITEMS flag is set)
+  GEMIndex dirtyItemLast = 0;
+  byte editValueCursorPosition = 0;             // Position of the edit cursor on screen
+  byte editValueVirtualCursorPosition = 0;      // Position of the edit cursor within the edited value (as drawn on screen)
+  /*
+    Follow edit cursor within the edited value, scrolling the visible part of the value (of the supplied length)
+    only as far as needed to keep the cursor on screen
+  */
+  void updateEditValueCursor(byte virtualCursorPosition, byte length);
+  bool areMenuItemsDirty(GEMIndex first, byte count);  // Check if any of the count menu items starting from the first one is within the dirty range
+};
+
+// Declaration of GEMController class
+class GEMController {
+  friend class GEM;
+  friend class GEM_u8g2;
+  friend class GEM_adafruit_gfx;
+  public:
+    GEMController();
+
+    /* NAVIGATION AND EDIT STATE (changed by the controller itself, should be treated as read-only) */
+
+    GEMPage* menuPageCurrent = nullptr;         // Current menu page (current menu item is stored in the menu page itself)
+    bool editValueMode = false;                 // Value of the current menu item is being edited
+    byte editValueType = 0;                     // Type of the edited variable
+    byte editValueLength = 0;                   // Max length of the string representation of the edited value
+    byte editValueVirtualCursorPosition = 0;    // Position of the edit cursor within the edited value
+    char valueString[GEM_STR_LEN] = "";         // String representation of the edited value
+    int valueSelectNum = -1;                    // Index of the option of select or spinner being edited
+
+    /* VIEWS */
+
+    void attachView(GEMView& view);             // Mark the view for redraw whenever navigation or edit state changes
+    void detachView(GEMView& view);
+    void markDirty(byte flags);                 // Mark all of the attached views for redraw (GEM_DIRTY_* flags)
+    void invalidateMenuItem(GEMItem& menuItem, bool following = false); // Mark menu item of the current menu page (and all of the following ones, if second argument is true)
+                                                //   to be redrawn by each of the attached views (e.g. when its linked variable was changed outside of the menu)
+
+    /* MENU ITEMS NAVIGATION */
+
+    void setMenuPageCurrent(GEMPage& menuPageCurrent_);
+    void goToMenuItem(GEMIndex index);
+    void goToMenuItem(GEMItem& menuItem);
+    void goToFirstMenuItem();
+    void goToLastMenuItem();
+    void goToPrevScreen(byte menuItemsPerScreen);
+    void goToNextScreen(byte menuItemsPerScreen);
+    void goToPrevInteractiveMenuItem();
+    void goToNextInteractiveMenuItem();
+
+    /* KEY DETECTION */
+
+    GEM_VIRTUAL void dispatchKeyPress(byte keyCode, byte menuItemsPerScreen);  // Accepts GEM_CONTROLLER_KEY_* values
+  protected:
+    bool _invertKeysDuringEdit = false;
+    bool _skipLineChar = false;                 // Skip '|' character during edit of char[17] variables (it can't be printed by AltSerialGraphicLCD)
+    GEMView* _view = nullptr;                   // First of the attached views
+    void markItemsDirty(GEMIndex first, GEMIndex last);  // Add range of menu items of the current menu page to the dirty range of each of the attached views
+
+    /* MENU ITEMS NAVIGATION */
+
+    GEM_VIRTUAL void nextMenuItem();
+    GEM_VIRTUAL void prevMenuItem();
+    GEM_VIRTUAL void menuItemSelect();
+    GEM_VIRTUAL void moveMenuPointer(GEMIndex menuItemNum);
+
+    /* VALUE EDIT */
+
+    GEM_VIRTUAL void enterEditValueMode();
+    GEM_VIRTUAL void checkboxToggle();
+    GEM_VIRTUAL void nextEditValueCursorPosition();
+    GEM_VIRTUAL void prevEditValueCursorPosition();
+    GEM_VIRTUAL void nextEditValueDigit();
+    GEM_VIRTUAL void prevEditValueDigit();
+    GEM_VIRTUAL byte nextEditValueCode(byte code);
+    GEM_VIRTUAL byte prevEditValueCode(byte code);
+    GEMAcceleration _charAcceleration = {0, 0, 1, 0};
+    GEMAcceleration _digitAcceleration = {0, 0, 1, 0};
+    byte _rapidKeyCount = 0;                    // Count of the preceding key presses of the rapid series (used to calculate step of accelerated edit)
+    char _rapidKeyDirection = 0;
+    unsigned long _rapidKeyTime = 0;
+    int getAccelerationSteps(GEMAcceleration& acceleration, char direction);
+    #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+    GEM_VIRTUAL void callPreviewCallback(bool reset = false);
+    #endif
+    GEM_VIRTUAL void setEditValueDigit(byte code);
+    GEM_VIRTUAL void nextEditValueSelect();
+    GEM_VIRTUAL void prevEditValueSelect();
+    #ifdef GEM_SUPPORT_SPINNER
+    GEM_VIRTUAL void nextEditValueSpinner();
+    GEM_VIRTUAL void prevEditValueSpinner();
+    #endif
+    GEM_VIRTUAL void saveEditValue();
+    GEM_VIRTUAL void cancelEditValue();
+    GEM_VIRTUAL void resetEditValueState();
+    GEM_VIRTUAL void exitEditValue();
+    void callMenuItemCallback(GEMItem* menuItem);  // Call callback of the menu item (checkbox or saved value) and redraw the menu afterwards
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+  GEMDrawnValues - hashes of the values of menu items drawn on screen for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <Arduino.h>
+#include "GEMDrawnValues.h"
+
+#ifdef GEM_ENABLE_REFRESH
+
+GEMDrawnValues::GEMDrawnValues() {
+  reset();
+}
+
+void GEMDrawnValues::store(const void* menuItem, uint32_t hash) {
+  for (byte i = 0; i < GEM_DRAWN_VALUES_SIZE; i++) {
+    if (_entries[i].menuItem == menuItem) {
+      _entries[i].hash = hash;
+      return;
+    }
+  }
+  GEMDrawnValuesEntry& entry = _entries[_next];
+  _next = (_next + 1) % GEM_DRAWN_VALUES_SIZE;
+  entry.menuItem = menuItem;
+  entry.hash = hash;
+}
+
+bool GEMDrawnValues::changed(const void* menuItem, uint32_t hash) {
+  for (byte i = 0; i < GEM_DRAWN_VALUES_SIZE; i++) {
+    if (_entries[i].menuItem == menuItem) {
+      return _entries[i].hash != hash;
+    }
+  }
+  return true;
+}
+
+void GEMDrawnValues::invalidate(const void* menuItem) {
+  for (byte i = 0; i < GEM_DRAWN_VALUES_SIZE; i++) {
+    if (_entries[i].menuItem == menuItem) {
+      _entries[i].menuItem = nullptr;
+    }
+  }
+}
+
+GEMDrawnValues& GEMDrawnValues::reset() {
+  memset(_entries, 0, sizeof(_entries));
+  _next = 0;
+  return *this;
+}
+
+#endif
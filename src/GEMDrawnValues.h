@@ -0,0 +1,84 @@
+/*
+  GEMDrawnValues - hashes of the values of menu items drawn on screen for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef HEADER_GEMDRAWNVALUES
+#define HEADER_GEMDRAWNVALUES
+
+#include <Arduino.h>
+#include "config.h"
+#include "constants.h"
+
+#ifdef GEM_ENABLE_REFRESH
+
+// Macro constant (alias) for the number of menu items drawn values of which are kept (can be redefined via compiler flag)
+#ifndef GEM_DRAWN_VALUES_SIZE
+#define GEM_DRAWN_VALUES_SIZE 8
+#endif
+
+// Declaration of GEMDrawnValuesEntry type
+struct GEMDrawnValuesEntry {
+  const void* menuItem;           // Menu item value of which was drawn (nullptr if entry is empty)
+  uint32_t hash;                  // Hash of the value at the time it was drawn (value itself for int, byte, bool and GEMFixed values)
+};
+
+
+// Declaration of GEMDrawnValues class
+class GEMDrawnValues {
+  public:
+    GEMDrawnValues();
+    /*
+      Record hash of the value of the menu item that was just drawn on screen
+      @param 'menuItem' - pointer to menu item
+      @param 'hash' - hash of the value (as returned by GEMItem::getValueHash())
+    */
+    void store(const void* menuItem, uint32_t hash);
+    /*
+      Check whether value of the menu item differs from the one drawn on screen (value that wasn't recorded is considered changed)
+      @param 'menuItem' - pointer to menu item
+      @param 'hash' - hash of the current value
+    */
+    bool changed(const void* menuItem, uint32_t hash);
+    void invalidate(const void* menuItem); // Forget hash of the drawn value of the menu item (e.g. when value is drawn bypassing store())
+    GEMDrawnValues& reset();          // Forget hashes of all of the drawn values
+  protected:
+    GEMDrawnValuesEntry _entries[GEM_DRAWN_VALUES_SIZE];
+    byte _next = 0;                   // Index of the entry to be replaced next
+};
+
+#endif
+
+#endif
@@ -0,0 +1,281 @@
+/*
+  GEMFormat - formatting and parsing of floating-point and fixed-point values for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <Arduino.h>
+#include "GEMFormat.h"
+#include "constants.h"
+#include "GEMFixed.h"
+
+// Powers of 10 up to 10^GEM_FORMAT_MAX_PREC
+static const uint32_t _powersOf10[GEM_FORMAT_MAX_PREC + 1] = {1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL};
+
+// Print digits of the value right to left, starting just before 'end'; 'count' is the minimum number of digits (leading zeros are added)
+static char* printDigits(uint32_t value, byte count, char* end) {
+  do {
+    *--end = '0' + (value % 10);
+    value /= 10;
+    if (count > 0) {
+      count--;
+    }
+  } while (value > 0 || count > 0);
+  return end;
+}
+
+// Print number with the supplied integer and fractional parts (the latter scaled by 10^precision)
+static char* printNumber(bool negative, uint32_t integerPart, uint32_t fractionalPart, byte precision, char* str) {
+  // Digits are printed right to left into the local buffer first (sign, 10 integer digits, decimal point and fractional digits)
+  char buffer[GEM_FORMAT_MAX_PREC + 13];
+  char* end = buffer + sizeof(buffer);
+  char* start = end;
+  if (precision > 0) {
+    start = printDigits(fractionalPart, precision, start);
+    *--start = '.';
+  }
+  start = printDigits(integerPart, 1, start);
+  if (negative) {
+    *--start = '-';
+  }
+  memcpy(str, start, end - start);
+  str[end - start] = '\0';
+  return str;
+}
+
+char* GEMFormat::formatFixed(int32_t value, byte precision, char* str) {
+  if (precision > GEM_FORMAT_MAX_PREC) {
+    precision = GEM_FORMAT_MAX_PREC;
+  }
+  bool negative = value < 0;
+  uint32_t absValue = negative ? 0UL - (uint32_t)value : (uint32_t)value;
+  return printNumber(negative, absValue / _powersOf10[precision], absValue % _powersOf10[precision], precision, str);
+}
+
+int32_t GEMFormat::parseFixed(const char* str, byte precision) {
+  if (precision > GEM_FORMAT_MAX_PREC) {
+    precision = GEM_FORMAT_MAX_PREC;
+  }
+  const char* chr = str;
+  while (*chr == ' ') {
+    chr++;
+  }
+  bool negative = false;
+  if (*chr == '-' || *chr == '+') {
+    negative = (*chr == '-');
+    chr++;
+  }
+  uint32_t integerPart = 0;
+  bool overflow = false;
+  for (; *chr >= '0' && *chr <= '9'; chr++) {
+    if (integerPart > 429496728UL) {
+      overflow = true;
+    } else {
+      integerPart = integerPart * 10 + (*chr - '0');
+    }
+  }
+  uint32_t fractionalPart = 0;
+  byte fractionalDigits = 0;
+  byte roundUp = 0;
+  if (*chr == '.') {
+    for (chr++; *chr >= '0' && *chr <= '9'; chr++) {
+      if (fractionalDigits < precision) {
+        fractionalPart = fractionalPart * 10 + (*chr - '0');
+        fractionalDigits++;
+      } else {
+        // The first of the digits beyond precision determines rounding
+        roundUp = (*chr >= '5') ? 1 : 0;
+        break;
+      }
+    }
+  }
+  for (; fractionalDigits < precision; fractionalDigits++) {
+    fractionalPart *= 10;
+  }
+  // Magnitude of the result is limited by the range of int32_t
+  uint32_t limit = negative ? 2147483648UL : 2147483647UL;
+  uint32_t absValue;
+  if (overflow || integerPart > (limit - fractionalPart - roundUp) / _powersOf10[precision]) {
+    absValue = limit;
+  } else {
+    absValue = integerPart * _powersOf10[precision] + fractionalPart + roundUp;
+  }
+  return negative ? (int32_t)(0UL - absValue) : (int32_t)absValue;
+}
+
+#ifdef GEM_SUPPORT_FLOAT_EDIT
+
+char* GEMFormat::formatFloat(double value, byte precision, char* str) {
+  bool negative = value < 0;
+  double absValue = negative ? -value : value;
+  // NaN fails the comparison as well
+  if (precision > GEM_FORMAT_MAX_PREC || !(absValue < 4294967295.0)) {
+    return dtostrf(value, precision + 1, precision, str);
+  }
+  uint32_t integerPart = (uint32_t)absValue;
+  uint32_t fractionalPart = (uint32_t)((absValue - integerPart) * _powersOf10[precision] + 0.5);
+  if (fractionalPart >= _powersOf10[precision]) {
+    // Rounding carried over into integer part
+    fractionalPart -= _powersOf10[precision];
+    if (integerPart == 4294967295UL) {
+      return dtostrf(value, precision + 1, precision, str);
+    }
+    integerPart++;
+  }
+  return printNumber(negative, integerPart, fractionalPart, precision, str);
+}
+
+double GEMFormat::parseFloat(const char* str) {
+  const char* chr = str;
+  while (*chr == ' ') {
+    chr++;
+  }
+  bool negative = false;
+  if (*chr == '-' || *chr == '+') {
+    negative = (*chr == '-');
+    chr++;
+  }
+  uint32_t mantissa = 0;
+  byte digits = 0;            // Significant digits accumulated in mantissa
+  byte fractionalDigits = 0;
+  bool point = false;
+  for (;; chr++) {
+    if (*chr >= '0' && *chr <= '9') {
+      if (digits > 0 || *chr != '0') {
+        if (digits == 9) {
+          // No more room in 32-bit mantissa
+          return atof(str);
+        }
+        digits++;
+      }
+      mantissa = mantissa * 10 + (*chr - '0');
+      if (point) {
+        if (fractionalDigits == GEM_FORMAT_MAX_PREC) {
+          return atof(str);
+        }
+        fractionalDigits++;
+      }
+    } else if (*chr == '.' && !point) {
+      point = true;
+    } else if (*chr == 'e' || *chr == 'E') {
+      // Exponent notation is left to atof()
+      return atof(str);
+    } else {
+      break;
+    }
+  }
+  double result = (double)mantissa / _powersOf10[fractionalDigits];
+  return negative ? -result : result;
+}
+
+#endif
+
+char* GEMFormat::formatValue(const void* variable, byte type, byte precision, char* str) {
+  #ifndef GEM_SUPPORT_FLOAT_EDIT
+  (void)precision; // Precision applies to float and double values only
+  #endif
+  switch (type) {
+    case GEM_VAL_INTEGER:
+      itoa(*(const int*)variable, str, 10);
+      break;
+    case GEM_VAL_BYTE:
+      itoa(*(const byte*)variable, str, 10);
+      break;
+    case GEM_VAL_CHAR:
+      strcpy(str, (const char*)variable);
+      break;
+    case GEM_VAL_FIXED:
+      formatFixed(((const GEMFixed*)variable)->value, ((const GEMFixed*)variable)->precision, str);
+      break;
+    #ifdef GEM_SUPPORT_FLOAT_EDIT
+    case GEM_VAL_FLOAT:
+      // sprintf(str,"%.6f", *(float*)variable); // May work for non-AVR boards
+      formatFloat(*(const float*)variable, precision, str);
+      break;
+    case GEM_VAL_DOUBLE:
+      formatFloat(*(const double*)variable, precision, str);
+      break;
+    #endif
+  }
+  return str;
+}
+
+void GEMFormat::parseValue(void* variable, byte type, char* str) {
+  switch (type) {
+    case GEM_VAL_INTEGER:
+      *(int*)variable = atoi(str);
+      break;
+    case GEM_VAL_BYTE:
+      *(byte*)variable = atoi(str);
+      break;
+    case GEM_VAL_CHAR:
+      strcpy((char*)variable, trim(str)); // Potential overflow if string length is not defined
+      break;
+    case GEM_VAL_FIXED:
+      {
+        GEMFixed* fixed = (GEMFixed*)variable;
+        fixed->value = parseFixed(str, fixed->precision);
+      }
+      break;
+    #ifdef GEM_SUPPORT_FLOAT_EDIT
+    case GEM_VAL_FLOAT:
+      *(float*)variable = parseFloat(str);
+      break;
+    case GEM_VAL_DOUBLE:
+      *(double*)variable = parseFloat(str);
+      break;
+    #endif
+  }
+}
+
+// Trim leading/trailing whitespaces
+// Author: Adam Rosenfield, https://stackoverflow.com/a/122721
+char* GEMFormat::trim(char* str) {
+  char *end;
+
+  // Trim leading space
+  while(isspace((unsigned char)*str)) str++;
+
+  if(*str == 0)  // All spaces?
+    return str;
+
+  // Trim trailing space
+  end = str + strlen(str) - 1;
+  while(end > str && isspace((unsigned char)*end)) end--;
+
+  // Write new null terminator
+  *(end+1) = 0;
+  
+  return str;
+}
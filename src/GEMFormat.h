@@ -0,0 +1,123 @@
+/*
+  GEMFormat - formatting and parsing of floating-point and fixed-point values for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef HEADER_GEMFORMAT
+#define HEADER_GEMFORMAT
+
+#include <Arduino.h>
+#include "config.h"
+
+#if defined(GEM_SUPPORT_FLOAT_EDIT) && (defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52840))
+// AVR-based Arduinos have suppoort for dtostrf, some others may require manual inclusion (e.g. SAMD),
+// see https://github.com/plotly/arduino-api/issues/38#issuecomment-108987647
+#include <avr/dtostrf.h>
+#endif
+
+// Macro constant (alias) for the maximum precision handled by scaled integer arithmetic (float values with higher precision are handled by dtostrf())
+#define GEM_FORMAT_MAX_PREC 9
+
+// Declaration of GEMFormat class
+class GEMFormat {
+  public:
+    /*
+      Format fixed-point value (e.g. value of GEMFixed variable), using integer arithmetic only
+      @param 'value' - value scaled by 10^precision
+      @param 'precision' - number of digits after decimal point (up to GEM_FORMAT_MAX_PREC)
+      @param 'str' - buffer to format value into
+    */
+    static char* formatFixed(int32_t value, byte precision, char* str);
+    /*
+      Parse fixed-point value, using integer arithmetic only (digits beyond precision are rounded, values out of range are saturated)
+      @param 'str' - string to parse
+      @param 'precision' - number of digits after decimal point (up to GEM_FORMAT_MAX_PREC)
+    */
+    static int32_t parseFixed(const char* str, byte precision);
+    /*
+      Read character of the string that is located either in RAM or in flash memory (PROGMEM)
+      @param 'str' - pointer to the string
+      @param 'index' - index of the character
+      @param 'progmem' - whether string is located in flash memory
+    */
+    static inline char readChar(const char* str, byte index, bool progmem) {
+      return progmem ? (char)pgm_read_byte(str + index) : str[index];
+    }
+    /*
+      Get length of the string that is located either in RAM or in flash memory (PROGMEM)
+    */
+    static inline size_t length(const char* str, bool progmem) {
+      return progmem ? strlen_P(str) : strlen(str);
+    }
+    /*
+      Format value of the variable of the supplied type (GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_FIXED, GEM_VAL_FLOAT, GEM_VAL_DOUBLE),
+      shared by all versions of GEM for printing of the menu items and entering edit mode
+      @param 'variable' - pointer to the variable
+      @param 'type' - type of the variable
+      @param 'precision' - number of digits after decimal point (relevant for float and double variables, GEMFixed variables hold their own precision)
+      @param 'str' - buffer to format value into
+    */
+    static char* formatValue(const void* variable, byte type, byte precision, char* str);
+    /*
+      Parse string (e.g. edited in edit mode) and assign the result to the variable of the supplied type (GEM_VAL_INTEGER, GEM_VAL_BYTE,
+      GEM_VAL_CHAR, GEM_VAL_FIXED, GEM_VAL_FLOAT, GEM_VAL_DOUBLE), shared by all versions of GEM for saving and previewing of the edited value
+      @param 'variable' - pointer to the variable (precision of GEMFixed variable should be set beforehand)
+      @param 'type' - type of the variable
+      @param 'str' - string to parse (leading/trailing whitespaces of char[] value are trimmed in place)
+    */
+    static void parseValue(void* variable, byte type, char* str);
+    /*
+      Trim leading/trailing whitespaces of the string (in place)
+    */
+    static char* trim(char* str);
+    #ifdef GEM_SUPPORT_FLOAT_EDIT
+    /*
+      Format floating-point value with the fixed number of digits after decimal point, using scaled integer arithmetic
+      (same format as of dtostrf(value, precision + 1, precision, str); dtostrf() itself is used for values that don't fit into 32-bit integer)
+      @param 'value' - value to format
+      @param 'precision' - number of digits after decimal point
+      @param 'str' - buffer to format value into
+    */
+    static char* formatFloat(double value, byte precision, char* str);
+    /*
+      Parse floating-point value, accumulating its digits in 32-bit integer
+      (result matches that of atof(str) for strings produced by formatFloat() or edited in edit mode; atof() itself is used for longer strings)
+      @param 'str' - string to parse
+    */
+    static double parseFloat(const char* str);
+    #endif
+};
+
+#endif
@@ -37,1732 +37,197 @@
 #include <Arduino.h>
 #include "GEMItem.h"
 #include "constants.h"
-
-GEMItem::GEMItem(const char* title_)
-  : title(title_)
-  , type(GEM_ITEM_LABEL)
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackAction(callbackAction_)
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , select(&select_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , select(&select_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , select(&select_)
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, bool readonly_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , select(&select_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , select(&select_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SELECT)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , select(&select_)
-{ }
-
-//---
-
-#ifdef GEM_SUPPORT_SPINNER
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackAction(callbackAction_)
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , spinner(&spinner_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , spinner(&spinner_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , spinner(&spinner_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , spinner(&spinner_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_SPINNER)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-  , spinner(&spinner_)
-{ }
+#include "GEMSelect.h"
+#include "GEMFormat.h"
+
+// Guard against accidental growth of GEMItem (its size is multiplied by the number of menu items): 4 bytes of types and flags,
+// 7 pointers (title, linked variable, select/spinner/linked page, parent page, next and next visible menu items, callback), optional pointers
+// to preview callback and to vtable (in Advanced Mode), and value of callback argument. That is 24 bytes on AVR and 48 bytes
+// on 32-bit ARM in default configuration
+#if defined(GEM_SUPPORT_PREVIEW_CALLBACKS) && defined(GEM_ENABLE_ADVANCED_MODE)
+#define GEM_ITEM_OPTIONAL_POINTERS 2
+#elif defined(GEM_SUPPORT_PREVIEW_CALLBACKS) || defined(GEM_ENABLE_ADVANCED_MODE)
+#define GEM_ITEM_OPTIONAL_POINTERS 1
+#else
+#define GEM_ITEM_OPTIONAL_POINTERS 0
+#endif
+#define GEM_ALIGN_UP(size, align) (((size) + (align) - 1) / (align) * (align))
+static_assert(sizeof(GEMItem) <= GEM_ALIGN_UP(GEM_ALIGN_UP(2 * sizeof(void*) + 4, alignof(void*)) + (5 + GEM_ITEM_OPTIONAL_POINTERS) * sizeof(void*), alignof(GEMCallbackValue)) + sizeof(GEMCallbackValue),
+              "GEMItem is larger than expected, check the order of its fields");
+#ifdef __AVR__
+static_assert(sizeof(GEMItem) == 22 + 2 * GEM_ITEM_OPTIONAL_POINTERS, "Unexpected size of GEMItem on AVR");
 #endif
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , precision(GEM_FLOAT_PREC)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)())
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , precision(GEM_DOUBLE_PREC)
-  , callbackAction(callbackAction_)
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, byte& linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BYTE)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-{ }
-
-GEMItem::GEMItem(const char* title_, int& linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_INTEGER)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-{ }
-
-GEMItem::GEMItem(const char* title_, char* linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(linkedVariable_)
-  , linkedType(GEM_VAL_CHAR)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-{ }
-
-GEMItem::GEMItem(const char* title_, bool& linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_BOOL)
-  , type(GEM_ITEM_VAL)
-  , readonly(readonly_)
-{ }
-
-GEMItem::GEMItem(const char* title_, float& linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_FLOAT)
-  , type(GEM_ITEM_VAL)
-  , precision(GEM_FLOAT_PREC)
-  , readonly(readonly_)
-{ }
-
-GEMItem::GEMItem(const char* title_, double& linkedVariable_, bool readonly_)
-  : title(title_)
-  , linkedVariable(&linkedVariable_)
-  , linkedType(GEM_VAL_DOUBLE)
-  , type(GEM_ITEM_VAL)
-  , precision(GEM_DOUBLE_PREC)
-  , readonly(readonly_)
-{ }
-
-//---
-
-GEMItem::GEMItem(const char* title_, GEMPage& linkedPage_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_LINK)
-  , readonly(readonly_)
-  , linkedPage(&linkedPage_)
-{ }
-
-GEMItem::GEMItem(const char* title_, GEMPage* linkedPage_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_LINK)
-  , readonly(readonly_)
-  , linkedPage(linkedPage_)
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(), bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackAction(callbackAction_)
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData))
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { 0 } }
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valByte = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), int callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valInt = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), float callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valFloat = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), double callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valDouble = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valBool = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valChar = callbackVal_ }}
-{ }
-
-GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_, bool readonly_)
-  : title(title_)
-  , type(GEM_ITEM_BUTTON)
-  , readonly(readonly_)
-  , callbackActionArg(callbackAction_)
-  , callbackWithArgs(true)
-  , callbackData{ this, { .valPointer = callbackVal_ }}
-{ }
-
-//---
 
 GEMItem& GEMItem::setCallbackVal(byte callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valByte = callbackVal_;
+  callbackVal.valByte = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(int callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valInt = callbackVal_;
+  callbackVal.valInt = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(float callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valFloat = callbackVal_;
+  callbackVal.valFloat = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(double callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valDouble = callbackVal_;
+  callbackVal.valDouble = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(bool callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valBool = callbackVal_;
+  callbackVal.valBool = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(const char* callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valChar = callbackVal_;
+  callbackVal.valChar = callbackVal_;
   return *this;
 }
 
 GEMItem& GEMItem::setCallbackVal(void* callbackVal_) {
-  callbackData.pMenuItem = this;
-  callbackData.valPointer = callbackVal_;
+  callbackVal.valPointer = callbackVal_;
   return *this;
 }
 
 GEMCallbackData GEMItem::getCallbackData() {
+  GEMCallbackData callbackData;
+  callbackData.pMenuItem = this;
+  memcpy(&callbackData.valByte, &callbackVal, sizeof(callbackVal));
   return callbackData;
 }
 
+#ifdef GEM_ENABLE_REFRESH
+// FNV-1a hash of the bytes of the value, seeded with precision it is drawn with
+static uint32_t hashValue(const void* value, byte size, byte precision) {
+  uint32_t hash = (2166136261UL ^ precision) * 16777619UL;
+  for (byte i = 0; i < size; i++) {
+    hash = (hash ^ ((const byte*)value)[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+uint32_t GEMItem::getValueHash() {
+  byte type = linkedType;
+  if (linkedType == GEM_VAL_SELECT) {
+    type = select->getType();
+  #ifdef GEM_SUPPORT_SPINNER
+  } else if (linkedType == GEM_VAL_SPINNER) {
+    type = spinner->getType();
+  #endif
+  }
+  // Values that fit into 32 bits are returned as is, so that any change of them is detected; only char[17], float and double values are hashed
+  switch (type) {
+    case GEM_VAL_INTEGER:
+      return (uint32_t)*(int*)linkedVariable;
+    case GEM_VAL_BYTE:
+      return *(byte*)linkedVariable;
+    case GEM_VAL_BOOL:
+      return *(bool*)linkedVariable;
+    case GEM_VAL_FIXED: {
+      // Precision (0-9) is packed into the upper 4 bits, which values of up to 28 bits leave free (larger values are hashed)
+      GEMFixed* fixed = (GEMFixed*)linkedVariable;
+      if (fixed->value >= -0x08000000L && fixed->value < 0x08000000L) {
+        return ((uint32_t)fixed->value & 0x0FFFFFFFUL) | ((uint32_t)(fixed->precision & 0x0F) << 28);
+      }
+      return hashValue(&fixed->value, sizeof(int32_t), fixed->precision);
+    }
+    case GEM_VAL_CHAR:
+      return hashValue(linkedVariable, strlen((char*)linkedVariable), 0);
+    case GEM_VAL_FLOAT:
+      return hashValue(linkedVariable, sizeof(float), linkedType == GEM_VAL_SELECT ? 0 : precision);
+    case GEM_VAL_DOUBLE:
+      return hashValue(linkedVariable, sizeof(double), linkedType == GEM_VAL_SELECT ? 0 : precision);
+    default:
+      return 0;
+  }
+}
+#endif
+
+int GEMItem::getSelectedOptionNum() {
+  // Value of the variable usually stays the same between redraws, so check the option it was last resolved to first
+  // (kept per menu item, because several menu items may share the same select)
+  if (selectOptionNum < select->getLength() && select->compareOptionValue(selectOptionNum, linkedVariable) == 0) {
+    return selectOptionNum;
+  }
+  int selectedOptionNum = select->getSelectedOptionNum(linkedVariable);
+  if (selectedOptionNum > -1) {
+    selectOptionNum = selectedOptionNum;
+  }
+  return selectedOptionNum;
+}
+
+void GEMItem::saveEditValue(char* valueString, int valueSelectNum) {
+  switch (linkedType) {
+    case GEM_VAL_SELECT:
+      select->setValue(linkedVariable, valueSelectNum);
+      if (valueSelectNum > -1) {
+        selectOptionNum = valueSelectNum;
+      }
+      break;
+    #ifdef GEM_SUPPORT_SPINNER
+    case GEM_VAL_SPINNER:
+      spinner->setValue(linkedVariable, valueSelectNum);
+      break;
+    #endif
+    default:
+      GEMFormat::parseValue(linkedVariable, linkedType, valueString);
+      break;
+  }
+}
+
+#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+GEMPreviewCallbackData GEMItem::getPreviewCallbackData(char* valueString, int valueSelectNum) {
+  GEMPreviewCallbackData previewCallbackData;
+  previewCallbackData.callbackData = getCallbackData();
+  if (valueString != nullptr) {
+    previewCallbackData.type = linkedType;
+    switch (linkedType) {
+      case GEM_VAL_INTEGER:
+      case GEM_VAL_BYTE:
+      case GEM_VAL_FIXED:
+      #ifdef GEM_SUPPORT_FLOAT_EDIT
+      case GEM_VAL_FLOAT:
+      case GEM_VAL_DOUBLE:
+      #endif
+        previewCallbackData.previewString = valueString;
+        if (linkedType == GEM_VAL_FIXED) {
+          previewCallbackData.previewValFixed.precision = ((GEMFixed*)linkedVariable)->precision;
+        }
+        // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
+        GEMFormat::parseValue(&previewCallbackData.previewValByte, linkedType, valueString);
+        break;
+      case GEM_VAL_CHAR:
+        previewCallbackData.previewString = valueString;
+        previewCallbackData.previewValChar = valueString;
+        break;
+      case GEM_VAL_SELECT:
+        previewCallbackData.previewSelectNum = valueSelectNum;
+        select->setValue(&previewCallbackData.previewValByte, valueSelectNum);
+        previewCallbackData.type = select->getType();
+        if (previewCallbackData.type == GEM_VAL_FIXED) {
+          previewCallbackData.previewValFixed.precision = ((GEMFixed*)linkedVariable)->precision;
+        }
+        break;
+      #ifdef GEM_SUPPORT_SPINNER
+      case GEM_VAL_SPINNER:
+        previewCallbackData.previewSelectNum = valueSelectNum;
+        spinner->setValue(&previewCallbackData.previewValByte, valueSelectNum, getLinkedVariablePointer());
+        previewCallbackData.type = spinner->getType();
+        if (previewCallbackData.type == GEM_VAL_FIXED) {
+          previewCallbackData.previewValFixed.precision = ((GEMFixed*)linkedVariable)->precision;
+        }
+        break;
+      #endif
+    }
+  }
+  return previewCallbackData;
+}
+#endif
+
 #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
 GEMItem& GEMItem::setPreviewCallback(void (*previewCallbackAction_)(GEMPreviewCallbackData)) {
   previewCallbackAction = previewCallbackAction_;
@@ -1779,6 +244,13 @@ GEMItem& GEMItem::removePreviewCallback() {
 
 GEMItem& GEMItem::setTitle(const char* title_) {
   title = title_;
+  flags.titleProgmem = false;
+  return *this;
+}
+
+GEMItem& GEMItem::setTitle(const __FlashStringHelper* title_) {
+  title = reinterpret_cast<const char*>(title_);
+  flags.titleProgmem = true;
   return *this;
 }
 
@@ -1800,26 +272,26 @@ GEMItem& GEMItem::setPrecision(byte prec) {
 }
 
 GEMItem& GEMItem::setAdjustedASCIIOrder(bool mode) {
-  adjustedAsciiOrder = mode;
+  flags.adjustedAsciiOrder = mode;
   return *this;
 }
 
 GEMItem& GEMItem::setReadonly(bool mode) {
-  readonly = mode;
+  flags.readonly = mode;
   return *this;
 }
 
 bool GEMItem::getReadonly() {
-  return readonly;
+  return flags.readonly;
 }
 
 GEMItem& GEMItem::hide(bool hide) {
   if (hide) {
-    if (!hidden) {
+    if (!flags.hidden) {
       if (parentPage != nullptr) {
         parentPage->hideMenuItem(*this);
       } else {
-        hidden = true;
+        flags.hidden = true;
       }
     }
   } else {
@@ -1829,18 +301,18 @@ GEMItem& GEMItem::hide(bool hide) {
 }
 
 GEMItem& GEMItem::show() {
-  if (hidden) {
+  if (flags.hidden) {
     if (parentPage != nullptr) {
       parentPage->showMenuItem(*this);
     } else {
-      hidden = false;
+      flags.hidden = false;
     }
   }
   return *this;
 }
 
 bool GEMItem::getHidden() {
-  return hidden;
+  return flags.hidden;
 }
 
 GEMItem& GEMItem::remove() {
@@ -1856,7 +328,7 @@ void* GEMItem::getLinkedVariablePointer() {
 
 #ifdef GEM_SUPPORT_SPINNER
 GEMSpinner* GEMItem::getSpinner() {
-  return spinner;
+  return (linkedType == GEM_VAL_SPINNER) ? spinner : nullptr;
 }
 #endif
 
@@ -1865,13 +337,9 @@ GEMPage* GEMItem::getParentPage() {
 }
 
 GEMPage* GEMItem::getLinkedPage() {
-  return linkedPage;
+  return (type == GEM_ITEM_LINK || type == GEM_ITEM_BACK) ? linkedPage : nullptr;
 }
 
 GEMItem* GEMItem::getMenuItemNext(bool total) {
-  GEMItem* menuItemTmp = menuItemNext;
-  while (menuItemTmp != nullptr && !total && menuItemTmp->hidden) {
-    menuItemTmp = menuItemTmp->menuItemNext;
-  }
-  return menuItemTmp;
+  return (total || menuItemNext == nullptr) ? menuItemNext : menuItemNextVisible; // Nothing follows the last menu item (or scratch menu item of provider) either way
 }
@@ -38,6 +38,7 @@
 #include "constants.h"
 #include "GEMPage.h"
 #include "GEMSpinner.h"
+#include "GEMFixed.h"
 
 #ifndef HEADER_GEMITEM
 #define HEADER_GEMITEM
@@ -78,250 +79,352 @@ struct GEMCallbackData {
   };
 };
 
+// Declaration of GEMCallbackValue type (user-defined value for callback argument as stored in menu item,
+// GEMCallbackData is assembled from it and pointer to menu item when callback is called)
+union GEMCallbackValue {
+  constexpr GEMCallbackValue() : valDouble(0) { }
+  constexpr GEMCallbackValue(byte valByte_) : valByte(valByte_) { }
+  constexpr GEMCallbackValue(int valInt_) : valInt(valInt_) { }
+  constexpr GEMCallbackValue(float valFloat_) : valFloat(valFloat_) { }
+  constexpr GEMCallbackValue(double valDouble_) : valDouble(valDouble_) { }
+  constexpr GEMCallbackValue(bool valBool_) : valBool(valBool_) { }
+  constexpr GEMCallbackValue(const char* valChar_) : valChar(valChar_) { }
+  constexpr GEMCallbackValue(void* valPointer_) : valPointer(valPointer_) { }
+  byte valByte;
+  int valInt;
+  float valFloat;
+  double valDouble;
+  bool valBoolean;
+  bool valBool;
+  const char* valChar;
+  void* valPointer;
+};
+
+// Declaration of GEMItemTarget type (object that menu item is associated with, only one of which is relevant
+// for the menu item depending on its type, hence members share the same storage)
+struct GEMItemTarget {
+  constexpr GEMItemTarget() : select(nullptr) { }
+  constexpr GEMItemTarget(GEMSelect* select_) : select(select_) { }
+  #ifdef GEM_SUPPORT_SPINNER
+  constexpr GEMItemTarget(GEMSpinner* spinner_) : spinner(spinner_) { }
+  #endif
+  constexpr GEMItemTarget(GEMPage* linkedPage_) : linkedPage(linkedPage_) { }
+  union {
+    GEMSelect* select;        // GEM_VAL_SELECT variable
+    #ifdef GEM_SUPPORT_SPINNER
+    GEMSpinner* spinner;      // GEM_VAL_SPINNER variable
+    #endif
+    GEMPage* linkedPage;      // GEM_ITEM_LINK menu link or GEM_ITEM_BACK button
+  };
+};
+
+// Declaration of GEMItemAction type (callback of the menu item, either w/ or w/o GEMCallbackData argument)
+struct GEMItemAction {
+  constexpr GEMItemAction() : callbackAction(nullptr) { }
+  constexpr GEMItemAction(void (*callbackAction_)()) : callbackAction(callbackAction_) { }
+  constexpr GEMItemAction(void (*callbackActionArg_)(GEMCallbackData)) : callbackActionArg(callbackActionArg_) { }
+  union {
+    void (*callbackAction)();
+    void (*callbackActionArg)(GEMCallbackData);
+  };
+};
+
+// Declaration of GEMItemFlags type (boolean properties of the menu item packed into a single byte)
+struct GEMItemFlags {
+  constexpr GEMItemFlags(bool readonly_ = false, bool callbackWithArgs_ = false)
+    : adjustedAsciiOrder(false)
+    , readonly(readonly_)
+    , hidden(false)
+    , titleProgmem(false)
+    , callbackWithArgs(callbackWithArgs_)
+  { }
+  bool adjustedAsciiOrder : 1;
+  bool readonly : 1;
+  bool hidden : 1;
+  bool titleProgmem : 1;  // Whether title is stored in flash memory (PROGMEM)
+  bool callbackWithArgs : 1;
+};
+
 #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
 // Declaration of GEMPreviewCallbackData type
 struct GEMPreviewCallbackData {
   GEMCallbackData callbackData;         // Struct of GEMCallbackData type (see declaration above), the same one that is passed to save callback
-  const char* previewString = nullptr;  // char* representation of editable variable (populated when editable variable is of type GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_FLOAT, GEM_VAL_DOUBLE)
+  const char* previewString = nullptr;  // char* representation of editable variable (populated when editable variable is of type GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_FLOAT, GEM_VAL_DOUBLE, GEM_VAL_FIXED)
   int previewSelectNum = -1;            // Index of currently previewed option (populated when editable variable is of type GEM_VAL_SELECT, GEM_VAL_SPINNER)
-  byte type;                            // Type of the preview value placed in the following anonymous union (GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_FLOAT, GEM_VAL_DOUBLE)
+  byte type;                            // Type of the preview value placed in the following anonymous union (GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_FLOAT, GEM_VAL_DOUBLE, GEM_VAL_FIXED)
   union {                               // Preview value casted to corresponding data type stored in uinion
     byte previewValByte;
     int previewValInt;
     float previewValFloat;
     double previewValDouble;
+    GEMFixed previewValFixed;
     const char* previewValChar;
   };
 };
 #endif
 
-// Declaration of GEMItem class
-class GEMItem {
+// Declaration of GEMItem class (associated object and callback are held in base structs, so that they can be
+// initialized by the single constexpr constructor that all of the public constructors delegate to)
+class GEMItem : protected GEMItemTarget, protected GEMItemAction {
   friend class GEM;
   friend class GEM_u8g2;
   friend class GEM_adafruit_gfx;
+  friend class GEMController;
   friend class GEMPage;
   public:
     /* 
       Constructor for menu item that represents non-interactive label
     */
-    GEMItem(const char* title_);
+    constexpr GEMItem(const char* title_);
     /* 
       Constructors for menu item that represents option select, w/ callback (optionally w/ user-defined callback argument)
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, float, double, or GEMFixed)
       @param 'select_' - reference to GEMSelect option select
       @param 'callbackAction_' - pointer to callback function executed when associated variable is successfully saved
       @param 'callbackVal_' - value of an argument that will be passed to callback within GEMCallbackData (either byte, int, bool, float, double, char or void pointer)
     */
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
-
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)());
+
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
     /* 
       Constructors for menu item that represents option select, w/o callback
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, float, double, or GEMFixed)
       @param 'select_' - reference to GEMSelect option select
       @param 'readonly_' (optional) - set readonly mode for variable that option select is associated with
       values GEM_READONLY (alias for true)
       default false
     */
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
-    GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, bool readonly_ = false);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, bool readonly_ = false);
     #ifdef GEM_SUPPORT_SPINNER
     /* 
       Constructors for menu item that represents spinner, w/ callback (optionally w/ user-defined callback argument)
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, float, double, or GEMFixed)
       @param 'spinner_' - reference to GEMSpinner object
       @param 'callbackAction_' - pointer to callback function executed when associated variable is successfully saved
       @param 'callbackVal_' - value of an argument that will be passed to callback within GEMCallbackData (either byte, int, bool, float, double, char or void pointer)
     */
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
-
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)());
+
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
     /* 
       Constructors for menu item that represents spinner, w/o callback
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, float, double, or GEMFixed)
       @param 'spinner_' - reference to GEMSpinner object
       @param 'readonly_' (optional) - set readonly mode for variable that spinner is associated with
       values GEM_READONLY (alias for true)
       default false
     */
-    GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
-    GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
-    GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
-    GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, bool readonly_ = false);
     #endif
     /* 
       Constructors for menu item that represents variable, w/ callback (optionally w/ user-defined callback argument)
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, bool, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, bool, float, double, or GEMFixed)
       @param 'callbackAction_' - pointer to callback function executed when associated variable is successfully saved
       @param 'callbackVal_' - value of an argument that will be passed to callback within GEMCallbackData (either byte, int, bool, float, double, char or void pointer)
     */
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)());
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)());
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)());
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)());
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)());
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)());
-
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
-
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
-    GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)());
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)());
+
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
+
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_);
     /* 
       Constructors for menu item that represents variable, w/o callback
       @param 'title_' - title of the menu item displayed on the screen
-      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, bool, float, or double)
+      @param 'linkedVariable_' - reference to variable that menu item is associated with (either byte, int, char*, bool, float, double, or GEMFixed)
       @param 'readonly_' (optional) - set readonly mode for variable that menu item is associated with
       values GEM_READONLY (alias for true)
       default false
     */
-    GEMItem(const char* title_, byte& linkedVariable_, bool readonly_ = false);
-    GEMItem(const char* title_, int& linkedVariable_, bool readonly_ = false);
-    GEMItem(const char* title_, char* linkedVariable_, bool readonly_ = false);
-    GEMItem(const char* title_, bool& linkedVariable_, bool readonly_ = false);
-    GEMItem(const char* title_, float& linkedVariable_, bool readonly_ = false);
-    GEMItem(const char* title_, double& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, byte& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, int& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, char* linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, bool& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, float& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, double& linkedVariable_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, GEMFixed& linkedVariable_, bool readonly_ = false);
     /* 
       Constructor for menu item that represents link to another menu page (via reference)
       @param 'title_' - title of the menu item displayed on the screen
@@ -329,7 +432,7 @@ class GEMItem {
       @param 'readonly_' (optional) - set readonly mode for the link (user won't be able to navigate to linked page)
       values GEM_READONLY (alias for true)
     */
-    GEMItem(const char* title_, GEMPage& linkedPage_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, GEMPage& linkedPage_, bool readonly_ = false);
     /* 
       Constructor for menu item that represents link to another menu page (via pointer)
       @param 'title_' - title of the menu item displayed on the screen
@@ -337,7 +440,7 @@ class GEMItem {
       @param 'readonly_' (optional) - set readonly mode for the link (user won't be able to navigate to linked page)
       values GEM_READONLY (alias for true)
     */
-    GEMItem(const char* title_, GEMPage* linkedPage_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, GEMPage* linkedPage_, bool readonly_ = false);
     /* 
       Constructor for menu item that represents button w/ callback (optionally w/ user-defined callback argument)
       @param 'title_' - title of the menu item displayed on the screen
@@ -346,15 +449,15 @@ class GEMItem {
       @param 'readonly_' (optional) - set readonly mode for the button (user won't be able to call action associated with it)
       values GEM_READONLY (alias for true)
     */
-    GEMItem(const char* title_, void (*callbackAction_)(), bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData));
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), int callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), float callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), double callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_, bool readonly_ = false);
-    GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(), bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData));
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), int callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), float callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), double callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_, bool readonly_ = false);
+    constexpr GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_, bool readonly_ = false);
 
     GEMItem& setCallbackVal(byte callbackVal_);         // Set value of an argument that will be passed to callback within GEMCallbackData (either byte, int, bool, float, double, char or void pointer)
     GEMItem& setCallbackVal(int callbackVal_);
@@ -369,6 +472,7 @@ class GEMItem {
     GEM_VIRTUAL GEMItem& removePreviewCallback();       // Remove preview callback that was called in edit mode when intermediate values of associated variable is changed
     #endif
     GEM_VIRTUAL GEMItem& setTitle(const char* title_);  // Set title of the menu item
+    GEMItem& setTitle(const __FlashStringHelper* title_); // Set title of the menu item that is stored in flash memory (e.g. wrapped in F() macro or declared as PROGMEM)
     GEM_VIRTUAL const char* getTitle();                 // Get title of the menu item
     byte getLinkedType();                               // Get type of linked variable (see linkedType field description below for possible values)
     byte getType();                                     // Get type of menu item (see type field description below for possible values)
@@ -390,32 +494,871 @@ class GEMItem {
     #endif
     GEM_VIRTUAL GEMPage* getParentPage();               // Get pointer to menu page that holds this menu item
     GEM_VIRTUAL GEMPage* getLinkedPage();               // Get pointer to menu page that menu link GEM_ITEM_LINK or back button GEM_ITEM_BACK links to
-    GEM_VIRTUAL GEMItem* getMenuItemNext(bool total = false); // Get next menu item (including hidden ones if total set to true)
+    GEM_VIRTUAL_DRAW GEMItem* getMenuItemNext(bool total = false) GEM_FINAL_DRAW; // Get next menu item (including hidden ones if total set to true)
   protected:
     const char* title;
     void* linkedVariable = nullptr;
-    byte linkedType;                                    // GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_BOOL, GEM_VAL_SELECT, GEM_VAL_FLOAT, GEM_VAL_DOUBLE, GEM_VAL_SPINNER
+    byte linkedType = 0;                                // GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_CHAR, GEM_VAL_BOOL, GEM_VAL_SELECT, GEM_VAL_FLOAT, GEM_VAL_DOUBLE, GEM_VAL_SPINNER
     byte type;                                          // GEM_ITEM_VAL, GEM_ITEM_LINK, GEM_ITEM_BACK, GEM_ITEM_BUTTON, GEM_ITEM_LABEL
-    byte precision = GEM_FLOAT_PREC;
-    bool adjustedAsciiOrder = false;
-    bool readonly = false;
-    bool hidden = false;
-    GEMSelect* select = nullptr;
-    #ifdef GEM_SUPPORT_SPINNER
-    GEMSpinner* spinner = nullptr;
-    #endif
+    union {
+      byte precision = GEM_FLOAT_PREC;
+      byte selectOptionNum;                             // Index of the option of select the linked variable was last resolved to, checked first on subsequent lookups (select menu items have no precision)
+    };
+    GEMItemFlags flags;
     GEMPage* parentPage = nullptr;
-    GEMPage* linkedPage = nullptr;
     GEMItem* menuItemNext = nullptr;
     union {
-      void (*callbackAction)() = nullptr;
-      void (*callbackActionArg)(GEMCallbackData);
+      GEMItem* menuItemNextVisible = nullptr;           // Next menu item that is not hidden (maintained by parent menu page)
+      GEMIndex providerIndex;                           // Index of the provider item materialized in scratch menu item (see GEMPage::setItemsProvider()), scratch menu items are never linked
     };
-    bool callbackWithArgs = false;
     #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
     void (*previewCallbackAction)(GEMPreviewCallbackData) = nullptr;
     #endif
-    GEMCallbackData callbackData = { this, { 0 } };
+    GEMCallbackValue callbackVal;
+    int getSelectedOptionNum();                                 // Get index of the option of select that value of linked variable matches (-1 if none)
+    void saveEditValue(char* valueString, int valueSelectNum);  // Assign value edited in edit mode (its string representation or index of the selected option) to linked variable
+    #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+    GEMPreviewCallbackData getPreviewCallbackData(char* valueString, int valueSelectNum);  // Get GEMPreviewCallbackData struct for the value edited in edit mode
+                                                                                           // (pass nullptr as valueString to get one without preview value, e.g. when edit is canceled)
+    #endif
+    #ifdef GEM_ENABLE_REFRESH
+    uint32_t getValueHash();                                    // Get hash of the current value of linked variable (used to check whether it changed since it was drawn):
+                                                                // value itself for int, byte, bool and GEMFixed variables, 32-bit hash for char[17], float and double ones
+    #endif
+  private:
+    constexpr GEMItem(const char* title_, byte type_, byte linkedType_, void* linkedVariable_, GEMItemTarget target_ = GEMItemTarget(), GEMItemAction action_ = GEMItemAction(),
+                      GEMItemFlags flags_ = GEMItemFlags(), GEMCallbackValue callbackVal_ = GEMCallbackValue(), byte precision_ = GEM_FLOAT_PREC);
 };
+
+// Constructors of GEMItem are constexpr (and thus defined in header), so that menu items declared globally
+// are initialized at compile time: no constructor code is generated for them and nothing is executed at startup.
+// Public constructors only map their arguments onto the one that actually initializes the fields
+
+constexpr GEMItem::GEMItem(const char* title_, byte type_, byte linkedType_, void* linkedVariable_, GEMItemTarget target_, GEMItemAction action_,
+                           GEMItemFlags flags_, GEMCallbackValue callbackVal_, byte precision_)
+  : GEMItemTarget(target_)
+  , GEMItemAction(action_)
+  , title(title_)
+  , linkedVariable(linkedVariable_)
+  , linkedType(linkedType_)
+  , type(type_)
+  , precision(precision_)
+  , flags(flags_)
+  , callbackVal(callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_)
+  : GEMItem(title_, GEM_ITEM_LABEL, 0, nullptr)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSelect& select_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SELECT, &linkedVariable_, &select_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+//---
+
+#ifdef GEM_SUPPORT_SPINNER
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, GEMSpinner& spinner_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_SPINNER, &linkedVariable_, &spinner_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+#endif
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(), GEMCallbackValue(), GEM_DOUBLE_PREC)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)())
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), int callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), float callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), double callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true), callbackVal_)
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, byte& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BYTE, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, int& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_INTEGER, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, char* linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_CHAR, linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, bool& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_BOOL, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, float& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FLOAT, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, double& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_DOUBLE, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_), GEMCallbackValue(), GEM_DOUBLE_PREC)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMFixed& linkedVariable_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_VAL, GEM_VAL_FIXED, &linkedVariable_, GEMItemTarget(), GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+//---
+
+constexpr GEMItem::GEMItem(const char* title_, GEMPage& linkedPage_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_LINK, 0, nullptr, &linkedPage_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, GEMPage* linkedPage_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_LINK, 0, nullptr, linkedPage_, GEMItemAction(), GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(), bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData))
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(false, true))
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), byte callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), int callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), float callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), double callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), bool callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), const char* callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
+
+constexpr GEMItem::GEMItem(const char* title_, void (*callbackAction_)(GEMCallbackData), void* callbackVal_, bool readonly_)
+  : GEMItem(title_, GEM_ITEM_BUTTON, 0, nullptr, GEMItemTarget(), callbackAction_, GEMItemFlags(readonly_, true), callbackVal_)
+{ }
   
 #endif
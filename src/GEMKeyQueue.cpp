@@ -0,0 +1,98 @@
+/*
+  GEMKeyQueue - queue of key presses that can be filled from interrupt service routine for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#include "GEMKeyQueue.h"
+
+#ifdef GEM_ENABLE_KEY_QUEUE
+
+// Single byte indices are read and written atomically on all of the supported architectures, so neither side has to disable interrupts:
+// producer only writes _head (after the key code is stored), consumer only writes _tail (after the key code is read)
+
+bool GEMKeyQueue::push(byte keyCode) {
+  byte head = _head;
+  if ((byte)(head - _tail) >= GEM_KEY_QUEUE_SIZE) {
+    _overflowCount++;
+    return false;
+  }
+  _keys[head & (GEM_KEY_QUEUE_SIZE - 1)] = keyCode;
+  _head = head + 1;
+  return true;
+}
+
+bool GEMKeyQueue::pop(byte& keyCode) {
+  byte tail = _tail;
+  byte count = _head - tail;
+  if (count == 0) {
+    return false;
+  }
+  if (count > _maxCount) {
+    _maxCount = count;
+  }
+  keyCode = _keys[tail & (GEM_KEY_QUEUE_SIZE - 1)];
+  _tail = tail + 1;
+  return true;
+}
+
+GEMKeyQueue& GEMKeyQueue::clear() {
+  _tail = _head;
+  return *this;
+}
+
+byte GEMKeyQueue::getCount() {
+  return _head - _tail;
+}
+
+uint16_t GEMKeyQueue::getOverflowCount() {
+  // 16-bit counter may be updated by producer in the middle of the read, so read it until two consecutive reads match
+  uint16_t overflowCount;
+  do {
+    overflowCount = _overflowCount;
+  } while (overflowCount != _overflowCount);
+  return overflowCount - _overflowCountReset;
+}
+
+byte GEMKeyQueue::getMaxCount() {
+  return _maxCount;
+}
+
+GEMKeyQueue& GEMKeyQueue::resetCounters() {
+  _overflowCountReset += getOverflowCount();
+  _maxCount = 0;
+  return *this;
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+  GEMKeyQueue - queue of key presses that can be filled from interrupt service routine for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEADER_GEMKEYQUEUE
+#define HEADER_GEMKEYQUEUE
+
+#include <Arduino.h>
+#include "config.h"
+
+#ifdef GEM_ENABLE_KEY_QUEUE
+
+// Macro constant (alias) for the capacity of the key queue (can be redefined via compiler flag, should be a power of 2 not greater than 128)
+#ifndef GEM_KEY_QUEUE_SIZE
+#define GEM_KEY_QUEUE_SIZE 8
+#endif
+
+#if (GEM_KEY_QUEUE_SIZE & (GEM_KEY_QUEUE_SIZE - 1)) != 0 || GEM_KEY_QUEUE_SIZE > 128
+#error "GEM_KEY_QUEUE_SIZE should be a power of 2 not greater than 128"
+#endif
+
+// Declaration of GEMKeyQueue class (lock-free queue with a single producer, e.g. interrupt service routine, and a single consumer, e.g. loop())
+class GEMKeyQueue {
+  public:
+    bool push(byte keyCode);            // Put the key code into the queue (producer side), returns false if the queue is full and the key code is dropped
+    bool pop(byte& keyCode);            // Take the oldest key code from the queue (consumer side), returns false if the queue is empty
+    GEMKeyQueue& clear();               // Discard all of the queued key codes (consumer side)
+    byte getCount();                    // Get count of the queued key codes
+    uint16_t getOverflowCount();        // Get count of the key codes dropped because the queue was full
+    byte getMaxCount();                 // Get the maximum count of the queued key codes observed by the consumer
+    GEMKeyQueue& resetCounters();       // Reset overflow count and maximum count (consumer side)
+  protected:
+    volatile byte _keys[GEM_KEY_QUEUE_SIZE];
+    volatile byte _head = 0;            // Count of pushed key codes (modulo 256), written by producer only
+    volatile byte _tail = 0;            // Count of popped key codes (modulo 256), written by consumer only
+    volatile uint16_t _overflowCount = 0;  // Written by producer only
+    uint16_t _overflowCountReset = 0;   // Value of _overflowCount at the time of the last reset
+    byte _maxCount = 0;
+};
+
+#endif
+
+#endif
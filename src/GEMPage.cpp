@@ -37,25 +37,35 @@
 #include <Arduino.h>
 #include "GEMPage.h"
 
-GEMPage::GEMPage(const char* title_)
+GEMPage::GEMPage(const char* title_, GEMPage& parentMenuPage_)
   : title(title_)
+{
+  setParentMenuPage(parentMenuPage_);
+}
+
+GEMPage::GEMPage(const __FlashStringHelper* title_)
+  : title(reinterpret_cast<const char*>(title_))
+  , titleProgmem(true)
 { }
 
-GEMPage::GEMPage(const char* title_, void (*exitAction_)())
-  : title(title_)
+GEMPage::GEMPage(const __FlashStringHelper* title_, void (*exitAction_)())
+  : title(reinterpret_cast<const char*>(title_))
+  , titleProgmem(true)
   , exitAction(exitAction_)
 { }
 
-GEMPage::GEMPage(const char* title_, GEMPage& parentMenuPage_)
-  : title(title_)
+GEMPage::GEMPage(const __FlashStringHelper* title_, GEMPage& parentMenuPage_)
+  : title(reinterpret_cast<const char*>(title_))
+  , titleProgmem(true)
 {
   setParentMenuPage(parentMenuPage_);
 }
 
-GEMPage& GEMPage::addMenuItem(GEMItem& menuItem, byte pos, bool total) {
+GEMPage& GEMPage::addMenuItem(GEMItem& menuItem, GEMIndex pos, bool total) {
   // Prevent adding menu item that was already added to another (or the same) page
   if (menuItem.parentPage == nullptr) {
-    byte itemsMax = total ? itemsCountTotal : itemsCount;
+    // Menu items supplied by provider always follow the ones added explicitly
+    GEMIndex itemsMax = (total ? itemsCountTotal : itemsCount) - _providerItemsCount;
     if (pos >= itemsMax) {
       // Cap maximum pos at number of items
       pos = itemsMax;
@@ -68,14 +78,17 @@ GEMPage& GEMPage::addMenuItem(GEMItem& menuItem, byte pos, bool total) {
       GEMItem* menuItemTmp = getMenuItem(pos-1, total);
       menuItem.menuItemNext = menuItemTmp->menuItemNext;
       menuItemTmp->menuItemNext = &menuItem;
+      relinkVisibleMenuItems(menuItemTmp->flags.hidden ? *getMenuItemPrevVisible(menuItem) : *menuItemTmp, menuItem);
     } else {
       // Link supplied menu item as a first menu item on a page
       menuItem.menuItemNext = _menuItem;
       _menuItem = &menuItem;
+      relinkVisibleMenuItems(menuItem, menuItem);
     }
     menuItem.parentPage = this;
+    resetMenuItemCache();
     itemsCountTotal++;
-    if (!menuItem.hidden) {
+    if (!menuItem.flags.hidden) {
       itemsCount++;
       currentItemNum = (_menuItemBack.linkedPage != nullptr) ? 1 : 0;
     }
@@ -83,6 +96,48 @@ GEMPage& GEMPage::addMenuItem(GEMItem& menuItem, byte pos, bool total) {
   return *this;
 }
 
+GEMPage& GEMPage::addMenuItems(GEMItem** menuItems, GEMIndex count) {
+  // Find the last menu item of the page once (menu items supplied by provider are not linked and always follow it),
+  // as well as the last visible one, links of which (and of the hidden menu items following it) are the only ones to update
+  GEMItem* menuItemLast = _menuItem;
+  GEMItem* menuItemPrevVisible = _menuItem;
+  while (menuItemLast != nullptr && menuItemLast->menuItemNext != nullptr) {
+    if (!menuItemLast->flags.hidden) {
+      menuItemPrevVisible = menuItemLast;
+    }
+    menuItemLast = menuItemLast->menuItemNext;
+  }
+  if (menuItemLast != nullptr && !menuItemLast->flags.hidden) {
+    menuItemPrevVisible = menuItemLast;
+  }
+  bool addedVisible = false;
+  for (GEMIndex i=0; i<count; i++) {
+    GEMItem& menuItem = *menuItems[i];
+    // Prevent adding menu item that was already added to another (or the same) page
+    if (menuItem.parentPage == nullptr) {
+      menuItem.menuItemNext = nullptr;
+      if (menuItemLast != nullptr) {
+        menuItemLast->menuItemNext = &menuItem;
+      } else {
+        _menuItem = &menuItem;
+      }
+      menuItemLast = &menuItem;
+      menuItem.parentPage = this;
+      itemsCountTotal++;
+      if (!menuItem.flags.hidden) {
+        itemsCount++;
+        addedVisible = true;
+      }
+    }
+  }
+  linkVisibleMenuItems(menuItemPrevVisible != nullptr ? menuItemPrevVisible : _menuItem);
+  resetMenuItemCache();
+  if (addedVisible) {
+    currentItemNum = (_menuItemBack.linkedPage != nullptr) ? 1 : 0;
+  }
+  return *this;
+}
+
 GEMPage& GEMPage::setParentMenuPage(GEMPage& parentMenuPage) {
   if (_menuItemBack.linkedPage == nullptr) {
     _menuItemBack.type = GEM_ITEM_BACK;
@@ -92,6 +147,8 @@ GEMPage& GEMPage::setParentMenuPage(GEMPage& parentMenuPage) {
     if (menuItemTmp != nullptr) {
       _menuItemBack.menuItemNext = menuItemTmp;
     }
+    relinkVisibleMenuItems(_menuItemBack, _menuItemBack);
+    resetMenuItemCache();
     itemsCount++;
     itemsCountTotal++;
     currentItemNum = (itemsCount > 1) ? 1 : 0;
@@ -102,6 +159,13 @@ GEMPage& GEMPage::setParentMenuPage(GEMPage& parentMenuPage) {
 
 GEMPage& GEMPage::setTitle(const char* title_) {
   title = title_;
+  titleProgmem = false;
+  return *this;
+}
+
+GEMPage& GEMPage::setTitle(const __FlashStringHelper* title_) {
+  title = reinterpret_cast<const char*>(title_);
+  titleProgmem = true;
   return *this;
 }
 
@@ -114,15 +178,41 @@ GEMPage& GEMPage::setAppearance(GEMAppearance* appearance) {
   return *this;
 }
 
-GEMItem* GEMPage::getMenuItem(byte index, bool total) {
+GEMItem* GEMPage::getMenuItem(GEMIndex index, bool total) {
+  if (_providerItemsCount > 0) {
+    GEMIndex itemsCountOwn = (total ? itemsCountTotal : itemsCount) - _providerItemsCount;
+    if (index >= itemsCountOwn) {
+      return getProviderItem(index - itemsCountOwn);
+    }
+  }
   if (_menuItem != nullptr) {
-    GEMItem* menuItemTmp = (!total && _menuItem->hidden) ? _menuItem->getMenuItemNext() : _menuItem;
-    for (byte i=0; i<index; i++) {
+    GEMItem* menuItemTmp = (!total && _menuItem->flags.hidden) ? _menuItem->getMenuItemNext() : _menuItem;
+    GEMIndex i = 0;
+    if (!total) {
+      // Start from the closest of the recently looked up menu items preceding the requested one
+      for (byte j=0; j<2; j++) {
+        if (_cachedMenuItem[j] != nullptr && _cachedMenuItemNum[j] <= index && _cachedMenuItemNum[j] >= i) {
+          menuItemTmp = _cachedMenuItem[j];
+          i = _cachedMenuItemNum[j];
+          if (i == index) {
+            _cachedMenuItemLast = j;
+            return menuItemTmp;
+          }
+        }
+      }
+    }
+    for (; i<index; i++) {
       menuItemTmp = menuItemTmp->getMenuItemNext(total);
       if (menuItemTmp == nullptr) {
         return nullptr;
       }
     }
+    if (!total && menuItemTmp != nullptr) {
+      // Replace least recently used slot
+      _cachedMenuItemLast = !_cachedMenuItemLast;
+      _cachedMenuItem[_cachedMenuItemLast] = menuItemTmp;
+      _cachedMenuItemNum[_cachedMenuItemLast] = index;
+    }
     return menuItemTmp;
   }
   return nullptr;
@@ -132,23 +222,63 @@ GEMItem* GEMPage::getCurrentMenuItem() {
   return getMenuItem(currentItemNum);
 }
 
-byte GEMPage::getCurrentMenuItemIndex() {
+GEMIndex GEMPage::getCurrentMenuItemIndex() {
   return currentItemNum;
 }
 
-GEMPage& GEMPage::setCurrentMenuItemIndex(byte index) {
+GEMPage& GEMPage::setCurrentMenuItemIndex(GEMIndex index) {
   currentItemNum = index;
   return *this;
 }
 
-byte GEMPage::getItemsCount(bool total) {
+GEMIndex GEMPage::getItemsCount(bool total) {
   return total ? itemsCountTotal : itemsCount;
 }
 
+GEMPage& GEMPage::setItemsProvider(GEMItem* items, byte itemsLength, GEMIndex (*countCallback)(), void (*fillCallback)(GEMItem&, GEMIndex)) {
+  _providerItems = items;
+  _providerItemsLength = itemsLength;
+  _providerCountCallback = countCallback;
+  _providerFillCallback = fillCallback;
+  for (byte i=0; i<itemsLength; i++) {
+    // Scratch menu items belong to the page but are never linked into the list of its menu items
+    items[i].parentPage = this;
+    items[i].menuItemNext = nullptr;
+  }
+  return refreshItems();
+}
+
+GEMPage& GEMPage::refreshItems() {
+  GEMIndex providerItemsCount = (_providerCountCallback != nullptr && _providerItemsLength > 0) ? _providerCountCallback() : 0;
+  itemsCount = itemsCount - _providerItemsCount + providerItemsCount;
+  itemsCountTotal = itemsCountTotal - _providerItemsCount + providerItemsCount;
+  _providerItemsCount = providerItemsCount;
+  for (byte i=0; i<_providerItemsLength; i++) {
+    _providerItems[i].providerIndex = GEM_LAST_POS; // Every slot of the ring is filled anew on the next lookup
+  }
+  if (currentItemNum >= itemsCount) {
+    currentItemNum = (itemsCount > 0) ? itemsCount - 1 : 0;
+  } else if (_menuItemBack.linkedPage != nullptr && currentItemNum == 0 && itemsCount > 1) {
+    currentItemNum = 1;
+  }
+  return *this;
+}
+
 int GEMPage::getMenuItemNum(GEMItem& menuItem, bool total) {
+  if (isProviderItem(menuItem)) {
+    GEMIndex itemsCountOwn = (total ? itemsCountTotal : itemsCount) - _providerItemsCount;
+    return (menuItem.providerIndex < _providerItemsCount) ? itemsCountOwn + menuItem.providerIndex : -1;
+  }
+  if (!total) {
+    for (byte j=0; j<2; j++) {
+      if (_cachedMenuItem[j] == &menuItem) {
+        return _cachedMenuItemNum[j];
+      }
+    }
+  }
   if (_menuItem != nullptr) {
-    GEMItem* menuItemTmp = (!total && _menuItem->hidden) ? _menuItem->getMenuItemNext() : _menuItem;
-    for (byte i=0; i<(total ? itemsCountTotal : itemsCount); i++) {
+    GEMItem* menuItemTmp = (!total && _menuItem->flags.hidden) ? _menuItem->getMenuItemNext() : _menuItem;
+    for (GEMIndex i=0; i<(total ? itemsCountTotal : itemsCount) - _providerItemsCount; i++) {
       if (menuItemTmp == &menuItem) {
         return i;
       }
@@ -159,8 +289,15 @@ int GEMPage::getMenuItemNum(GEMItem& menuItem, bool total) {
 }
 
 void GEMPage::hideMenuItem(GEMItem& menuItem) {
+  if (isProviderItem(menuItem)) {
+    // Visibility of menu items supplied by provider is governed by its items count
+    return;
+  }
   int menuItemNum = getMenuItemNum(menuItem);
-  menuItem.hidden = true;
+  GEMItem* menuItemPrevVisible = (menuItemNum > 0) ? getMenuItem(menuItemNum-1) : _menuItem;
+  menuItem.flags.hidden = true;
+  relinkVisibleMenuItems(*menuItemPrevVisible, menuItem);
+  resetMenuItemCache();
   itemsCount--;
   if (menuItemNum <= currentItemNum) {
     if (currentItemNum > 0) {
@@ -173,7 +310,12 @@ void GEMPage::hideMenuItem(GEMItem& menuItem) {
 }
 
 void GEMPage::showMenuItem(GEMItem& menuItem) {
-  menuItem.hidden = false;
+  if (isProviderItem(menuItem)) {
+    return;
+  }
+  menuItem.flags.hidden = false;
+  relinkVisibleMenuItems(*getMenuItemPrevVisible(menuItem), menuItem);
+  resetMenuItemCache();
   itemsCount++;
   int menuItemNum = getMenuItemNum(menuItem);
   if (menuItemNum <= currentItemNum) {
@@ -187,10 +329,21 @@ void GEMPage::showMenuItem(GEMItem& menuItem) {
 }
 
 void GEMPage::removeMenuItem(GEMItem& menuItem) {
+  if (isProviderItem(menuItem)) {
+    return;
+  }
   int menuItemNum = getMenuItemNum(menuItem);
   int menuItemNumTotal = getMenuItemNum(menuItem, true);
+  if (!menuItem.flags.hidden) {
+    // Preceding menu items that linked to the removed one as the next visible menu item now link to the one following it
+    // (links of the menu items preceding hidden menu item already skip it)
+    GEMItem* menuItemPrevVisible = (menuItemNum > 0) ? getMenuItem(menuItemNum-1) : _menuItem;
+    for (GEMItem* menuItemTmp = menuItemPrevVisible; menuItemTmp != &menuItem; menuItemTmp = menuItemTmp->menuItemNext) {
+      menuItemTmp->menuItemNextVisible = menuItem.menuItemNextVisible;
+    }
+  }
   itemsCountTotal--;
-  if (!menuItem.hidden) {
+  if (!menuItem.flags.hidden) {
     itemsCount--;
     if (menuItemNum <= currentItemNum) {
       if (currentItemNum > 0) {
@@ -208,4 +361,82 @@ void GEMPage::removeMenuItem(GEMItem& menuItem) {
   }
   menuItem.parentPage = nullptr;
   menuItem.menuItemNext = nullptr;
+  menuItem.menuItemNextVisible = nullptr;
+  resetMenuItemCache();
+}
+
+void GEMPage::resetMenuItemCache() {
+  _cachedMenuItem[0] = nullptr;
+  _cachedMenuItem[1] = nullptr;
+}
+
+void GEMPage::linkVisibleMenuItems(GEMItem* menuItemFirst) {
+  // Single pass over menu items starting from the supplied one: each visible menu item becomes the next visible one
+  // for every preceding menu item that has none assigned yet (i.e. for the run of hidden menu items in between)
+  GEMItem* menuItemPending = menuItemFirst;
+  GEMItem* menuItemTmp = (menuItemFirst != nullptr) ? menuItemFirst->menuItemNext : nullptr;
+  while (menuItemTmp != nullptr) {
+    if (!menuItemTmp->flags.hidden) {
+      while (menuItemPending != menuItemTmp) {
+        menuItemPending->menuItemNextVisible = menuItemTmp;
+        menuItemPending = menuItemPending->menuItemNext;
+      }
+    }
+    menuItemTmp = menuItemTmp->menuItemNext;
+  }
+  while (menuItemPending != nullptr) {
+    menuItemPending->menuItemNextVisible = nullptr;
+    menuItemPending = menuItemPending->menuItemNext;
+  }
+}
+
+void GEMPage::relinkVisibleMenuItems(GEMItem& menuItemPrevVisible, GEMItem& menuItem) {
+  // Only the supplied menu item and the ones preceding it up to the closest visible one are affected by its visibility
+  GEMItem* menuItemNext = menuItem.menuItemNext;
+  menuItem.menuItemNextVisible = (menuItemNext != nullptr && menuItemNext->flags.hidden) ? menuItemNext->menuItemNextVisible : menuItemNext;
+  GEMItem* menuItemNextVisible = menuItem.flags.hidden ? menuItem.menuItemNextVisible : &menuItem;
+  for (GEMItem* menuItemTmp = &menuItemPrevVisible; menuItemTmp != &menuItem; menuItemTmp = menuItemTmp->menuItemNext) {
+    menuItemTmp->menuItemNextVisible = menuItemNextVisible;
+  }
+}
+
+GEMItem* GEMPage::getMenuItemPrevVisible(GEMItem& menuItem) {
+  // First menu item of the page stands in for the closest preceding visible menu item if there is none
+  GEMItem* menuItemPrevVisible = _menuItem;
+  for (GEMItem* menuItemTmp = _menuItem; menuItemTmp != nullptr && menuItemTmp != &menuItem; menuItemTmp = menuItemTmp->menuItemNext) {
+    if (!menuItemTmp->flags.hidden) {
+      menuItemPrevVisible = menuItemTmp;
+    }
+  }
+  return menuItemPrevVisible;
+}
+
+GEMItem* GEMPage::getMenuItemNext(GEMItem& menuItem) {
+  if (isProviderItem(menuItem)) {
+    // Menu items supplied by provider follow each other in order of their indices
+    return (menuItem.providerIndex < _providerItemsCount) ? getProviderItem(menuItem.providerIndex + 1) : nullptr;
+  }
+  GEMItem* menuItemNext = menuItem.getMenuItemNext();
+  if (menuItemNext == nullptr && _providerItemsCount > 0 && !menuItem.flags.hidden) {
+    // Last of the visible menu items added explicitly is followed by the first one supplied by provider
+    menuItemNext = getProviderItem(0);
+  }
+  return menuItemNext;
+}
+
+GEMItem* GEMPage::getProviderItem(GEMIndex index) {
+  if (index >= _providerItemsCount) {
+    return nullptr;
+  }
+  GEMItem* menuItem = &_providerItems[index % _providerItemsLength];
+  if (menuItem->providerIndex != index) {
+    // Slot holds another provider item (or none yet), consecutive items never share the slot as long as the ring is not shorter than the screen
+    menuItem->providerIndex = index;
+    _providerFillCallback(*menuItem, index);
+  }
+  return menuItem;
+}
+
+bool GEMPage::isProviderItem(GEMItem& menuItem) {
+  return _providerItemsLength > 0 && &menuItem >= _providerItems && &menuItem < _providerItems + _providerItemsLength;
 }
\ No newline at end of file
@@ -38,11 +38,24 @@
 #define HEADER_GEMPAGE
 
 #include <Arduino.h>
-#include "GEMAppearance.h"
-#include "GEMItem.h"
+#include "config.h"
+
+// Type of indices and counts of menu items within the page (see GEM_ENABLE_WIDE_INDEX in config.h)
+#ifdef GEM_ENABLE_WIDE_INDEX
+typedef uint16_t GEMIndex;
+#else
+typedef byte GEMIndex;
+#endif
 
 // Macro constant (alias) for the last possible position that menu item can be added at
+#ifdef GEM_ENABLE_WIDE_INDEX
+#define GEM_LAST_POS 65535
+#else
 #define GEM_LAST_POS 255
+#endif
+
+#include "GEMAppearance.h"
+#include "GEMItem.h"
 
 // Macro constant (alias) for modifier of GEMPage::addMenuItem() method for the case when all menu items should be considered
 #define GEM_ITEMS_TOTAL true
@@ -55,6 +68,7 @@ class GEMPage {
   friend class GEM;
   friend class GEM_u8g2;
   friend class GEM_adafruit_gfx;
+  friend class GEMController;
   friend class GEMItem;
   public:
     /* 
@@ -62,33 +76,76 @@ class GEMPage {
       @param 'exitAction_' - pointer to callback function executed when GEM_KEY_CANCEL is pressed while being on top level menu page
       @param 'parentMenuPage_' - reference to parent level menu page (to know where to go back to when Back button is pressed)
     */
-    GEMPage(const char* title_ = "");
-    GEMPage(const char* title_, void (*exitAction_)());
+    constexpr GEMPage(const char* title_ = "");
+    constexpr GEMPage(const char* title_, void (*exitAction_)());
     GEMPage(const char* title_, GEMPage& parentMenuPage_);
-    GEM_VIRTUAL GEMPage& addMenuItem(GEMItem& menuItem, byte pos = GEM_LAST_POS, bool total = GEM_ITEMS_TOTAL);  // Add menu item to menu page (optionally at specified index out of total or only visible items)
+    GEMPage(const __FlashStringHelper* title_);                             // Same as above, but with title stored in flash memory (e.g. wrapped in F() macro or declared as PROGMEM)
+    GEMPage(const __FlashStringHelper* title_, void (*exitAction_)());
+    GEMPage(const __FlashStringHelper* title_, GEMPage& parentMenuPage_);
+    GEM_VIRTUAL GEMPage& addMenuItem(GEMItem& menuItem, GEMIndex pos = GEM_LAST_POS, bool total = GEM_ITEMS_TOTAL);  // Add menu item to menu page (optionally at specified index out of total or only visible items)
+    template <typename... MenuItems>
+    GEMPage& addMenuItems(GEMItem& menuItem, MenuItems&... menuItems) {     // Add several menu items to the end of menu page at once
+      GEMItem* menuItemsList[] = {&menuItem, &menuItems...};
+      return addMenuItems(menuItemsList, 1 + sizeof...(menuItems));
+    }
+    GEM_VIRTUAL GEMPage& addMenuItems(GEMItem** menuItems, GEMIndex count); // Add array of menu items to the end of menu page (linking them in a single pass)
     GEM_VIRTUAL GEMPage& setParentMenuPage(GEMPage& parentMenuPage);        // Specify parent level menu page (to know where to go back to when Back button is pressed)
     GEM_VIRTUAL GEMPage& setTitle(const char* title_);                      // Set title of the menu page
+    GEMPage& setTitle(const __FlashStringHelper* title_);                   // Set title of the menu page that is stored in flash memory
     GEM_VIRTUAL const char* getTitle();                                     // Get title of the menu page
     GEMPage& setAppearance(GEMAppearance* appearance);                      // Set appearance of the menu page
-    GEM_VIRTUAL GEMItem* getMenuItem(byte index, bool total = false);       // Get pointer to menu item by index (counting hidden ones if total set to true)
+    GEM_VIRTUAL GEMItem* getMenuItem(GEMIndex index, bool total = false);   // Get pointer to menu item by index (counting hidden ones if total set to true)
     GEM_VIRTUAL GEMItem* getCurrentMenuItem();                              // Get pointer to current menu item
-    GEM_VIRTUAL byte getCurrentMenuItemIndex();                             // Get index of current menu item
-    GEMPage& setCurrentMenuItemIndex(byte index);                           // Set index of current menu item
-    GEM_VIRTUAL byte getItemsCount(bool total = false);                     // Get items count of the menu page (counting hidden ones if total set to true)
+    GEM_VIRTUAL GEMIndex getCurrentMenuItemIndex();                         // Get index of current menu item
+    GEMPage& setCurrentMenuItemIndex(GEMIndex index);                       // Set index of current menu item
+    GEM_VIRTUAL GEMIndex getItemsCount(bool total = false);                 // Get items count of the menu page (counting hidden ones if total set to true)
+    GEMPage& setItemsProvider(GEMItem* items, byte itemsLength, GEMIndex (*countCallback)(), void (*fillCallback)(GEMItem&, GEMIndex));
+                                                                            // Supply menu items of the page on demand (materializing only requested ones in a ring of itemsLength scratch items)
+    GEMPage& refreshItems();                                                // Request items count from the provider again and discard materialized menu items
   protected:
     const char* title;
-    byte currentItemNum = 0;                                                // Currently selected (focused) menu item of the page
-    byte itemsCount = 0;                                                    // Items count excluding hidden ones
-    byte itemsCountTotal = 0;                                               // Items count incuding hidden ones
+    bool titleProgmem = false;                                              // Whether title is stored in flash memory (PROGMEM)
+    GEMIndex currentItemNum = 0;                                            // Currently selected (focused) menu item of the page
+    GEMIndex itemsCount = 0;                                                // Items count excluding hidden ones
+    GEMIndex itemsCountTotal = 0;                                           // Items count incuding hidden ones
     GEM_VIRTUAL int getMenuItemNum(GEMItem& menuItem, bool total = false);  // Find index of the supplied menu item
     void hideMenuItem(GEMItem& menuItem);
     void showMenuItem(GEMItem& menuItem);
     GEM_VIRTUAL void removeMenuItem(GEMItem& menuItem);                     // Remove menu item from menu page
+    GEMItem* getMenuItemNext(GEMItem& menuItem);                            // Get next visible menu item (continuing into the items supplied by provider)
     GEMItem* _menuItem = nullptr;                                           // First menu item of the page (the following ones are linked from within one another)
     GEMItem _menuItemBack {"", static_cast<GEMPage*>(nullptr)};             // Local instance of Back button (created when parent level menu page is specified through
                                                                             // setParentMenuPage(); always becomes the first menu item in a list)
     void (*exitAction)() = nullptr;
     GEMAppearance* _appearance = nullptr;
+    GEMItem* _cachedMenuItem[2] = {nullptr, nullptr};                       // Two most recently looked up visible menu items (used as starting points of the following lookups,
+    GEMIndex _cachedMenuItemNum[2] = {0, 0};                                // e.g. first menu item of the screen and current menu item during drawing of the menu)
+    byte _cachedMenuItemLast = 0;                                           // Index of the cache slot used most recently
+    void resetMenuItemCache();                                              // Should be called whenever list of visible menu items changes
+    void linkVisibleMenuItems(GEMItem* menuItemFirst);                      // Update pointers to the next visible menu item of the menu items starting from
+                                                                            // the supplied one up to the end of the page (used when menu items are appended)
+    void relinkVisibleMenuItems(GEMItem& menuItemPrevVisible, GEMItem& menuItem); // Update pointers to the next visible menu item after supplied menu item was added,
+                                                                            // hidden or shown (of itself and of the preceding ones, starting from the closest visible one)
+    GEMItem* getMenuItemPrevVisible(GEMItem& menuItem);                     // Get the closest visible menu item preceding the supplied one (or the first one of the page)
+    GEMItem* _providerItems = nullptr;                                      // Scratch menu items used as a ring to materialize items supplied by provider
+    byte _providerItemsLength = 0;
+    GEMIndex (*_providerCountCallback)() = nullptr;
+    void (*_providerFillCallback)(GEMItem&, GEMIndex) = nullptr;
+    GEMIndex _providerItemsCount = 0;                                       // Items count reported by provider (included in itemsCount and itemsCountTotal)
+    GEMItem* getProviderItem(GEMIndex index);                               // Materialize provider item by its index in the slot index % itemsLength of the ring (calling fill callback only if the slot holds another item)
+    bool isProviderItem(GEMItem& menuItem);
 };
+
+// Constructors of GEMPage that don't link it to parent menu page are constexpr, so that menu pages declared globally
+// (along with their Back button menu items) are initialized at compile time
+
+constexpr GEMPage::GEMPage(const char* title_)
+  : title(title_)
+{ }
+
+constexpr GEMPage::GEMPage(const char* title_, void (*exitAction_)())
+  : title(title_)
+  , exitAction(exitAction_)
+{ }
   
 #endif
@@ -0,0 +1,129 @@
+/*
+  GEMProfiler - draw primitives counters and per-frame rendering profile for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#include "GEMProfiler.h"
+
+#ifdef GEM_ENABLE_PROFILING
+
+GEMProfiler::GEMProfiler() {
+  reset();
+}
+
+GEMProfileFrame* GEMProfiler::getFrame(byte index) {
+  if (index >= _count) {
+    return nullptr;
+  }
+  return &_frames[(_head + GEM_PROFILE_FRAMES - 1 - index) % GEM_PROFILE_FRAMES];
+}
+
+byte GEMProfiler::getFramesCount() {
+  return _count;
+}
+
+uint16_t GEMProfiler::getPrimitivesCount(byte index) {
+  uint16_t total = 0;
+  GEMProfileFrame* frame = getFrame(index);
+  if (frame != nullptr) {
+    for (byte i = 0; i < GEM_PROFILE_PHASES; i++) {
+      for (byte j = 0; j < GEM_PRIMITIVES; j++) {
+        total += frame->phases[i].primitives[j];
+      }
+    }
+  }
+  return total;
+}
+
+GEMProfiler& GEMProfiler::reset() {
+  memset(_frames, 0, sizeof(_frames));
+  _head = 0;
+  _count = 0;
+  _depth = 0;
+  _phase = GEM_PROFILE_OTHER;
+  return *this;
+}
+
+void GEMProfiler::beginFrame() {
+  if (_depth == 0) {
+    memset(&_frames[_head], 0, sizeof(GEMProfileFrame));
+    _phase = GEM_PROFILE_OTHER;
+    _frameStart = micros();
+    _phaseStart = _frameStart;
+  }
+  _depth++;
+}
+
+void GEMProfiler::endFrame() {
+  if (_depth == 0) {
+    return;
+  }
+  _depth--;
+  if (_depth == 0) {
+    switchPhase(GEM_PROFILE_OTHER);
+    _frames[_head].micros = micros() - _frameStart;
+    _head = (_head + 1) % GEM_PROFILE_FRAMES;
+    if (_count < GEM_PROFILE_FRAMES) {
+      _count++;
+    }
+  }
+}
+
+void GEMProfiler::beginPhase(byte phase) {
+  switchPhase(phase);
+}
+
+void GEMProfiler::endPhase() {
+  switchPhase(GEM_PROFILE_OTHER);
+}
+
+void GEMProfiler::switchPhase(byte phase) {
+  // Time elapsed since the last switch is attributed to the phase that was active during it
+  uint32_t now = micros();
+  if (_depth > 0) {
+    _frames[_head].phases[_phase].micros += now - _phaseStart;
+  }
+  _phase = phase;
+  _phaseStart = now;
+}
+
+void GEMProfiler::count(byte primitive, uint16_t num) {
+  // Primitives issued outside of the frame (e.g. splash screen) are not recorded
+  if (_depth > 0) {
+    _frames[_head].phases[_phase].primitives[primitive] += num;
+  }
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+  GEMProfiler - draw primitives counters and per-frame rendering profile for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEADER_GEMPROFILER
+#define HEADER_GEMPROFILER
+
+#include <Arduino.h>
+#include "config.h"
+
+#ifdef GEM_ENABLE_PROFILING
+
+// Macro constant (alias) for the number of the last frames stored in profile (can be redefined via compiler flag)
+#ifndef GEM_PROFILE_FRAMES
+#define GEM_PROFILE_FRAMES 4
+#endif
+
+// Macro constants (aliases) for the phases of the frame
+#define GEM_PROFILE_TITLE 0       // drawTitleBar()
+#define GEM_PROFILE_ITEMS 1       // printMenuItems()
+#define GEM_PROFILE_POINTER 2     // drawMenuPointer()
+#define GEM_PROFILE_SCROLLBAR 3   // drawScrollbar()
+#define GEM_PROFILE_CALLBACK 4    // Callback set via setDrawMenuCallback()
+#define GEM_PROFILE_OTHER 5       // Anything outside of the phases above (e.g. partial updates in edit mode, sending data to the display)
+#define GEM_PROFILE_PHASES 6
+
+// Macro constants (aliases) for the types of draw primitives
+#define GEM_PRIMITIVE_PIXEL 0     // Single pixel
+#define GEM_PRIMITIVE_CHAR 1      // Single character of text (strings are counted per character)
+#define GEM_PRIMITIVE_RECT 2      // Filled box or screen clear
+#define GEM_PRIMITIVE_LINE 3      // Line
+#define GEM_PRIMITIVE_BITMAP 4    // Bitmap or sprite
+#define GEM_PRIMITIVES 5
+
+// Declaration of GEMProfilePhase type
+struct GEMProfilePhase {
+  uint16_t primitives[GEM_PRIMITIVES];  // Count of draw primitives of each type issued during the phase
+  uint32_t micros;                      // Time spent in the phase, microseconds
+};
+
+// Declaration of GEMProfileFrame type
+struct GEMProfileFrame {
+  GEMProfilePhase phases[GEM_PROFILE_PHASES]; // Profile of each of the phases of the frame
+  uint32_t micros;                            // Total time of the frame, microseconds
+};
+
+// Forward declaration of necessary classes
+class GEM;
+class GEM_u8g2;
+class GEM_adafruit_gfx;
+
+// Declaration of GEMProfiler class
+class GEMProfiler {
+  friend class GEM;
+  friend class GEM_u8g2;
+  friend class GEM_adafruit_gfx;
+  public:
+    GEMProfiler();
+    GEMProfileFrame* getFrame(byte index = 0);    // Get profile of the frame (0 - the most recent frame, 1 - the one before it, etc.), nullptr if not recorded yet
+    byte getFramesCount();                        // Get count of the recorded frames (up to GEM_PROFILE_FRAMES)
+    uint16_t getPrimitivesCount(byte index = 0);  // Get total count of draw primitives issued during the frame
+    GEMProfiler& reset();                         // Discard all of the recorded frames
+  protected:
+    GEMProfileFrame _frames[GEM_PROFILE_FRAMES];
+    byte _head = 0;     // Index of the frame currently being recorded
+    byte _count = 0;
+    byte _depth = 0;    // Nesting level of the frames (e.g. drawMenu() called while handling key press)
+    byte _phase = GEM_PROFILE_OTHER;
+    uint32_t _frameStart = 0;
+    uint32_t _phaseStart = 0;
+    void beginFrame();
+    void endFrame();
+    void beginPhase(byte phase);
+    void endPhase();
+    void switchPhase(byte phase);
+    void count(byte primitive, uint16_t num = 1);
+};
+
+// Macros used internally to instrument draw operations
+#define GEM_PROFILE_FRAME_BEGIN() _profiler.beginFrame()
+#define GEM_PROFILE_FRAME_END() _profiler.endFrame()
+#define GEM_PROFILE_PHASE_BEGIN(phase) _profiler.beginPhase(phase)
+#define GEM_PROFILE_PHASE_END() _profiler.endPhase()
+#define GEM_PROFILE_COUNT(primitive, num) _profiler.count(primitive, num)
+
+#else
+
+#define GEM_PROFILE_FRAME_BEGIN()
+#define GEM_PROFILE_FRAME_END()
+#define GEM_PROFILE_PHASE_BEGIN(phase)
+#define GEM_PROFILE_PHASE_END()
+#define GEM_PROFILE_COUNT(primitive, num)
+
+#endif
+
+#endif
@@ -38,40 +38,20 @@
 #include "GEMSelect.h"
 #include "constants.h"
 
-GEMSelect::GEMSelect(byte length_, SelectOptionInt* options_, bool loop_)
-  : _type(GEM_VAL_INTEGER)
-  , _length(length_)
-  , _options(options_)
-  , _loop(loop_)
-{ }
-
-GEMSelect::GEMSelect(byte length_, SelectOptionByte* options_, bool loop_)
-  : _type(GEM_VAL_BYTE)
-  , _length(length_)
-  , _options(options_)
-  , _loop(loop_)
-{ }
-
-GEMSelect::GEMSelect(byte length_, SelectOptionChar* options_, bool loop_)
-  : _type(GEM_VAL_CHAR)
-  , _length(length_)
-  , _options(options_)
-  , _loop(loop_)
-{ }
-
-GEMSelect::GEMSelect(byte length_, SelectOptionFloat* options_, bool loop_)
-  : _type(GEM_VAL_FLOAT)
-  , _length(length_)
-  , _options(options_)
-  , _loop(loop_)
-{ }
-
-GEMSelect::GEMSelect(byte length_, SelectOptionDouble* options_, bool loop_)
-  : _type(GEM_VAL_DOUBLE)
-  , _length(length_)
-  , _options(options_)
-  , _loop(loop_)
-{ }
+// Read field of the option that is located either in RAM or in flash memory (PROGMEM)
+template <typename T>
+static inline T readOptionField(const T* field, bool progmem) {
+  if (progmem) {
+    T value;
+    memcpy_P(&value, field, sizeof(T));
+    return value;
+  }
+  return *field;
+}
+
+// Name of the option printed when value of the linked variable matches none of the options (in flash memory,
+// so that it can be read the same way as names of the options of select that is declared as PROGMEM)
+static const char emptyOptionName[] PROGMEM = "";
 
 GEMSelect& GEMSelect::setLoop(bool mode) {
   _loop = mode;
@@ -90,34 +70,119 @@ byte GEMSelect::getLength() {
   return _length;
 }
 
+GEMSelect& GEMSelect::setSorted(bool mode) {
+  _sorted = mode;
+  return *this;
+}
+
+bool GEMSelect::getSorted() {
+  return _sorted;
+}
+
+GEMSelect& GEMSelect::setProgmem(bool mode) {
+  _progmem = mode;
+  return *this;
+}
+
+bool GEMSelect::getProgmem() {
+  return _progmem;
+}
+
+int GEMSelect::compareOptionValue(byte index, void* variable) {
+  switch (_type) {
+    case GEM_VAL_INTEGER: {
+      int val = readOptionField(&((SelectOptionInt*)_options)[index].val_int, _progmem);
+      return (val < *(int*)variable) ? -1 : (val > *(int*)variable);
+    }
+    case GEM_VAL_BYTE: {
+      byte val = readOptionField(&((SelectOptionByte*)_options)[index].val_byte, _progmem);
+      return (val < *(byte*)variable) ? -1 : (val > *(byte*)variable);
+    }
+    case GEM_VAL_CHAR: {
+      const char* val = readOptionField(&((SelectOptionChar*)_options)[index].val_char, _progmem);
+      return _progmem ? -strcmp_P((char*)variable, val) : strcmp(val, (char*)variable);
+    }
+    case GEM_VAL_FLOAT: {
+      float val = readOptionField(&((SelectOptionFloat*)_options)[index].val_float, _progmem);
+      return (val < *(float*)variable) ? -1 : (val > *(float*)variable);
+    }
+    case GEM_VAL_DOUBLE: {
+      double val = readOptionField(&((SelectOptionDouble*)_options)[index].val_double, _progmem);
+      return (val < *(double*)variable) ? -1 : (val > *(double*)variable);
+    }
+    case GEM_VAL_FIXED: {
+      int32_t val = readOptionField(&((SelectOptionFixed*)_options)[index].val_fixed, _progmem);
+      return (val < ((GEMFixed*)variable)->value) ? -1 : (val > ((GEMFixed*)variable)->value);
+    }
+  }
+  return -1;
+}
+
 int GEMSelect::getSelectedOptionNum(void* variable) {
-  SelectOptionInt* optsInt = (SelectOptionInt*)_options;
-  SelectOptionByte* optsByte = (SelectOptionByte*)_options;
-  SelectOptionChar* optsChar = (SelectOptionChar*)_options;
-  SelectOptionFloat* optsFloat = (SelectOptionFloat*)_options;
-  SelectOptionDouble* optsDouble = (SelectOptionDouble*)_options;
-  bool found = false;
-  for (byte i=0; i<_length; i++) {
+  int found = -1;
+  if (_sorted) {
+    byte lo = 0;
+    byte hi = _length;
+    while (lo < hi) {
+      byte mid = lo + (hi - lo) / 2;
+      int cmp = compareOptionValue(mid, variable);
+      if (cmp < 0) {
+        lo = mid + 1;
+      } else {
+        if (cmp == 0) { found = mid; }
+        hi = mid;
+      }
+    }
+  } else if (_progmem) {
+    byte i = 0;
+    while (i < _length && compareOptionValue(i, variable) != 0) { i++; }
+    if (i < _length) { found = i; }
+  } else {
+    // Type dispatch is hoisted out of the loop to keep the scan tight
+    byte i = 0;
     switch (_type) {
-      case GEM_VAL_INTEGER:
-        if (optsInt[i].val_int == *(int*)variable) { found = true; }
+      case GEM_VAL_INTEGER: {
+        SelectOptionInt* optsInt = (SelectOptionInt*)_options;
+        int val = *(int*)variable;
+        while (i < _length && optsInt[i].val_int != val) { i++; }
         break;
-      case GEM_VAL_BYTE:
-        if (optsByte[i].val_byte == *(byte*)variable) { found = true; }
+      }
+      case GEM_VAL_BYTE: {
+        SelectOptionByte* optsByte = (SelectOptionByte*)_options;
+        byte val = *(byte*)variable;
+        while (i < _length && optsByte[i].val_byte != val) { i++; }
         break;
-      case GEM_VAL_CHAR:
-        if (strcmp(optsChar[i].val_char, (char*)variable) == 0) { found = true; }
+      }
+      case GEM_VAL_CHAR: {
+        SelectOptionChar* optsChar = (SelectOptionChar*)_options;
+        while (i < _length && strcmp(optsChar[i].val_char, (char*)variable) != 0) { i++; }
         break;
-      case GEM_VAL_FLOAT:
-        if (optsFloat[i].val_float == *(float*)variable) { found = true; }
+      }
+      case GEM_VAL_FLOAT: {
+        SelectOptionFloat* optsFloat = (SelectOptionFloat*)_options;
+        float val = *(float*)variable;
+        while (i < _length && optsFloat[i].val_float != val) { i++; }
         break;
-      case GEM_VAL_DOUBLE:
-        if (optsDouble[i].val_double == *(double*)variable) { found = true; }
+      }
+      case GEM_VAL_DOUBLE: {
+        SelectOptionDouble* optsDouble = (SelectOptionDouble*)_options;
+        double val = *(double*)variable;
+        while (i < _length && optsDouble[i].val_double != val) { i++; }
+        break;
+      }
+      case GEM_VAL_FIXED: {
+        SelectOptionFixed* optsFixed = (SelectOptionFixed*)_options;
+        int32_t val = ((GEMFixed*)variable)->value;
+        while (i < _length && optsFixed[i].val_fixed != val) { i++; }
+        break;
+      }
+      default:
+        i = _length;
         break;
     }
-    if (found) { return i; }
+    if (i < _length) { found = i; }
   }
-  return -1;
+  return found;
 }
 
 const char* GEMSelect::getSelectedOptionName(void* variable) {
@@ -126,30 +191,37 @@ const char* GEMSelect::getSelectedOptionName(void* variable) {
 }
 
 const char* GEMSelect::getOptionNameByIndex(int index) {
+  if (index < 0 || index >= _length) {
+    return _progmem ? emptyOptionName : "";
+  }
   const char* name;
   SelectOptionInt* optsInt = (SelectOptionInt*)_options;
   SelectOptionByte* optsByte = (SelectOptionByte*)_options;
   SelectOptionChar* optsChar = (SelectOptionChar*)_options;
   SelectOptionFloat* optsFloat = (SelectOptionFloat*)_options;
   SelectOptionDouble* optsDouble = (SelectOptionDouble*)_options;
+  SelectOptionFixed* optsFixed = (SelectOptionFixed*)_options;
   switch (_type) {
     case GEM_VAL_INTEGER:
-      name = (index > -1 && index < _length) ? optsInt[index].name : "";
+      name = readOptionField(&optsInt[index].name, _progmem);
       break;
     case GEM_VAL_BYTE:
-      name = (index > -1 && index < _length) ? optsByte[index].name : "";
+      name = readOptionField(&optsByte[index].name, _progmem);
       break;
     case GEM_VAL_CHAR:
-      name = (index > -1 && index < _length) ? optsChar[index].name : "";
+      name = readOptionField(&optsChar[index].name, _progmem);
       break;
     case GEM_VAL_FLOAT:
-      name = (index > -1 && index < _length) ? optsFloat[index].name : "";
+      name = readOptionField(&optsFloat[index].name, _progmem);
       break;
     case GEM_VAL_DOUBLE:
-      name = (index > -1 && index < _length) ? optsDouble[index].name : "";
+      name = readOptionField(&optsDouble[index].name, _progmem);
+      break;
+    case GEM_VAL_FIXED:
+      name = readOptionField(&optsFixed[index].name, _progmem);
       break;
     default:
-      name = "";
+      name = _progmem ? emptyOptionName : "";
       break;
   }
   return name;
@@ -161,23 +233,31 @@ void GEMSelect::setValue(void* variable, int index) {
   SelectOptionChar* optsChar = (SelectOptionChar*)_options;
   SelectOptionFloat* optsFloat = (SelectOptionFloat*)_options;
   SelectOptionDouble* optsDouble = (SelectOptionDouble*)_options;
+  SelectOptionFixed* optsFixed = (SelectOptionFixed*)_options;
   if (index > -1 && index < _length) {
     switch (_type) {
       case GEM_VAL_INTEGER:
-        *(int*)variable = optsInt[index].val_int;
+        *(int*)variable = readOptionField(&optsInt[index].val_int, _progmem);
         break;
       case GEM_VAL_BYTE:
-        *(byte*)variable = optsByte[index].val_byte;
+        *(byte*)variable = readOptionField(&optsByte[index].val_byte, _progmem);
         break;
       case GEM_VAL_CHAR:
-        strcpy((char*)variable, optsChar[index].val_char);
+        if (_progmem) {
+          strcpy_P((char*)variable, readOptionField(&optsChar[index].val_char, _progmem));
+        } else {
+          strcpy((char*)variable, optsChar[index].val_char);
+        }
         break;
       case GEM_VAL_FLOAT:
-        *(float*)variable = optsFloat[index].val_float;
+        *(float*)variable = readOptionField(&optsFloat[index].val_float, _progmem);
         break;
         break;
       case GEM_VAL_DOUBLE:
-        *(double*)variable = optsDouble[index].val_double;
+        *(double*)variable = readOptionField(&optsDouble[index].val_double, _progmem);
+        break;
+      case GEM_VAL_FIXED:
+        ((GEMFixed*)variable)->value = readOptionField(&optsFixed[index].val_fixed, _progmem);
         break;
     }
   }
@@ -39,6 +39,7 @@
 
 #include "config.h"
 #include "constants.h"
+#include "GEMFixed.h"
 
 // Declaration of SelectOptionInt type
 struct SelectOptionInt {
@@ -70,11 +71,19 @@ struct SelectOptionDouble {
   double val_double;
 };
 
+// Declaration of SelectOptionFixed type
+struct SelectOptionFixed {
+  const char* name;
+  int32_t val_fixed;   // Value of the option scaled by 10^precision of the linked GEMFixed variable
+};
+
 // Declaration of GEMSelect class
 class GEMSelect {
   friend class GEM;
   friend class GEM_u8g2;
   friend class GEM_adafruit_gfx;
+  friend class GEMController;
+  friend class GEMItem;
   public:
     /* 
       @param 'length_' - length of the 'options_' array
@@ -82,24 +91,77 @@ class GEMSelect {
       @param 'loop_' (optional) - whether iteration over options should be looped
       values GEM_LOOP (alias for true)
     */
-    GEMSelect(byte length_, SelectOptionInt* options_, bool loop_ = false);
-    GEMSelect(byte length_, SelectOptionByte* options_, bool loop_ = false);
-    GEMSelect(byte length_, SelectOptionChar* options_, bool loop_ = false);
-    GEMSelect(byte length_, SelectOptionFloat* options_, bool loop_ = false);
-    GEMSelect(byte length_, SelectOptionDouble* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionInt* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionByte* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionChar* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionFloat* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionDouble* options_, bool loop_ = false);
+    constexpr GEMSelect(byte length_, SelectOptionFixed* options_, bool loop_ = false);
     GEMSelect& setLoop(bool mode = true);  // Explicitly set or unset loop mode
     bool getLoop();                        // Get current value of loop mode
+    GEMSelect& setSorted(bool mode = true); // Declare that options are sorted by value in ascending order (strcmp() order for char[] options),
+                                            // so that selected option is looked up via binary search
+    bool getSorted();                      // Get current value of sorted mode
+    GEMSelect& setProgmem(bool mode = true); // Declare that options array (as well as names of the options and char[] values) is stored in flash memory (PROGMEM)
+    bool getProgmem();                     // Get current value of PROGMEM mode
   protected:
     byte _type;
     byte _length;
     void* _options;
     bool _loop = false;
+    bool _sorted = false;
+    bool _progmem = false;
     byte getType();
     byte getLength();
+    int compareOptionValue(byte index, void* variable);  // Compare value of the option with supplied index against supplied variable
     GEM_VIRTUAL int getSelectedOptionNum(void* variable);
-    GEM_VIRTUAL const char* getSelectedOptionName(void* variable);
+    GEM_VIRTUAL_DRAW const char* getSelectedOptionName(void* variable) GEM_FINAL_DRAW;
     GEM_VIRTUAL const char* getOptionNameByIndex(int index);
     GEM_VIRTUAL void setValue(void* variable, int index);  // Assign value of the selected option to supplied variable
 };
+
+// Constructors of GEMSelect are constexpr, so that option selects declared globally are initialized at compile time
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionInt* options_, bool loop_)
+  : _type(GEM_VAL_INTEGER)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionByte* options_, bool loop_)
+  : _type(GEM_VAL_BYTE)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionChar* options_, bool loop_)
+  : _type(GEM_VAL_CHAR)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionFloat* options_, bool loop_)
+  : _type(GEM_VAL_FLOAT)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionDouble* options_, bool loop_)
+  : _type(GEM_VAL_DOUBLE)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
+
+constexpr GEMSelect::GEMSelect(byte length_, SelectOptionFixed* options_, bool loop_)
+  : _type(GEM_VAL_FIXED)
+  , _length(length_)
+  , _options(options_)
+  , _loop(loop_)
+{ }
   
 #endif
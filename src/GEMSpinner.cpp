@@ -52,6 +52,13 @@ GEMSpinner::GEMSpinner(GEMSpinnerBoundariesInt boundaries_, bool loop_)
   , _loop(loop_)
 { }
 
+GEMSpinner::GEMSpinner(GEMSpinnerBoundariesFixed boundaries_, bool loop_)
+  : _boundaries{ { .boundariesFixed = { .step = abs(boundaries_.step), .min = boundaries_.min < boundaries_.max ? boundaries_.min : boundaries_.max, .max = boundaries_.max > boundaries_.min ? boundaries_.max : boundaries_.min } } }
+  , _type(GEM_VAL_FIXED)
+  , _length(abs((boundaries_.max - boundaries_.min) / boundaries_.step) + 1)
+  , _loop(loop_)
+{ }
+
 #ifdef GEM_SUPPORT_FLOAT_EDIT
 GEMSpinner::GEMSpinner(GEMSpinnerBoundariesFloat boundaries_, bool loop_)
   : _boundaries{ { .boundariesFloat = { .step = abs(boundaries_.step), .min = boundaries_.min < boundaries_.max ? boundaries_.min : boundaries_.max, .max = boundaries_.max > boundaries_.min ? boundaries_.max : boundaries_.min } } }
@@ -77,6 +84,16 @@ bool GEMSpinner::getLoop() {
   return _loop;
 }
 
+GEMSpinner& GEMSpinner::setAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _acceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
+
+GEMSpinner& GEMSpinner::setAcceleration(GEMAcceleration acceleration) {
+  _acceleration = acceleration;
+  return *this;
+}
+
 byte GEMSpinner::getType() {
   return _type;
 }
@@ -106,6 +123,15 @@ int GEMSpinner::getSelectedOptionNum(void* variable) {
         }
       }
       break;
+    case GEM_VAL_FIXED:
+      {
+        GEMSpinnerBoundariesFixed boundaries = _boundaries.boundariesFixed;
+        int32_t val = ((GEMFixed*)variable)->value;
+        if (val >= boundaries.min && val <= boundaries.max) {
+          num = (val - boundaries.min) / boundaries.step;
+        }
+      }
+      break;
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     case GEM_VAL_FLOAT:
       {
@@ -152,6 +178,15 @@ GEMSpinnerValue GEMSpinner::getOptionNameByIndex(void* variable, int index) {
         value.valInt = *(int*)variable;
       }
       break;
+    case GEM_VAL_FIXED:
+      if (selectedOptionNum > -1) {
+        GEMSpinnerBoundariesFixed boundaries = _boundaries.boundariesFixed;
+        int32_t val = ((GEMFixed*)variable)->value + (int32_t)(index - selectedOptionNum) * boundaries.step;
+        value.valFixed = val <= boundaries.max ? val : val - boundaries.step;
+      } else {
+        value.valFixed = ((GEMFixed*)variable)->value;
+      }
+      break;
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     case GEM_VAL_FLOAT:
       if (selectedOptionNum > -1) {
@@ -186,6 +221,9 @@ void GEMSpinner::setValue(void* variable, int index, void* referenceVariable) {
     case GEM_VAL_INTEGER:
       *(int*)variable = value.valInt;
       break;
+    case GEM_VAL_FIXED:
+      ((GEMFixed*)variable)->value = value.valFixed;
+      break;
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     case GEM_VAL_FLOAT:
       *(float*)variable = value.valFloat;
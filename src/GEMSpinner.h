@@ -39,6 +39,8 @@
 
 #include "config.h"
 #include "constants.h"
+#include "GEMFixed.h"
+#include "GEMAcceleration.h"
 
 // Declaration of GEMSpinnerBoundariesByte type
 struct GEMSpinnerBoundariesByte {
@@ -54,6 +56,13 @@ struct GEMSpinnerBoundariesInt {
   int max;
 };
 
+// Declaration of GEMSpinnerBoundariesFixed type (values are scaled by 10^precision of the linked GEMFixed variable)
+struct GEMSpinnerBoundariesFixed {
+  int32_t step;
+  int32_t min;
+  int32_t max;
+};
+
 #ifdef GEM_SUPPORT_FLOAT_EDIT
 // Declaration of GEMSpinnerBoundariesFloat type
 struct GEMSpinnerBoundariesFloat {
@@ -75,6 +84,7 @@ struct GEMSpinnerBoundaries {
   union {
     GEMSpinnerBoundariesByte boundariesByte;
     GEMSpinnerBoundariesInt boundariesInt;
+    GEMSpinnerBoundariesFixed boundariesFixed;
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     GEMSpinnerBoundariesFloat boundariesFloat;
     GEMSpinnerBoundariesDouble boundariesDouble;
@@ -87,6 +97,7 @@ struct GEMSpinnerValue {
   union {
     byte valByte;
     int valInt;
+    int32_t valFixed;
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     float valFloat;
     double valDouble;
@@ -99,6 +110,8 @@ class GEMSpinner {
   friend class GEM;
   friend class GEM_u8g2;
   friend class GEM_adafruit_gfx;
+  friend class GEMController;
+  friend class GEMItem;
   public:
     /* 
       @param 'boundaries_' - boundaries of the spinner of corresponding type
@@ -107,18 +120,23 @@ class GEMSpinner {
     */
     GEMSpinner(GEMSpinnerBoundariesByte boundaries_, bool loop_ = false);
     GEMSpinner(GEMSpinnerBoundariesInt boundaries_, bool loop_ = false);
+    GEMSpinner(GEMSpinnerBoundariesFixed boundaries_, bool loop_ = false);
     #ifdef GEM_SUPPORT_FLOAT_EDIT
     GEMSpinner(GEMSpinnerBoundariesFloat boundaries_, bool loop_ = false);
     GEMSpinner(GEMSpinnerBoundariesDouble boundaries_, bool loop_ = false);
     #endif
     GEMSpinner& setLoop(bool mode = true);  // Explicitly set or unset loop mode
     bool getLoop();                         // Get current value of loop mode
+    GEMSpinner& setAcceleration(uint16_t interval = 150, byte pressesPerStage = 10, byte factor = 10, byte maxStage = 2);  // Accelerate spinner on rapid key presses (by default: x10 after 10 key presses, x100 after 20),
+                                                                                                                        // pass 0 as interval to disable acceleration
+    GEMSpinner& setAcceleration(GEMAcceleration acceleration);  // Set acceleration curve of the spinner
     GEM_VIRTUAL GEMSpinnerValue getOptionNameByIndex(void* variable, int index);  // Get option by its index
   protected:
     GEMSpinnerBoundaries _boundaries;
     byte _type;
     int _length;
     bool _loop = false;
+    GEMAcceleration _acceleration = {0, 0, 1, 0};
     byte getType();
     int getLength();
     GEM_VIRTUAL int getSelectedOptionNum(void* variable);
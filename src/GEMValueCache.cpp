@@ -0,0 +1,98 @@
+/*
+  GEMValueCache - cache of formatted values of menu items for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <Arduino.h>
+#include "GEMValueCache.h"
+
+#ifdef GEM_ENABLE_VALUE_CACHE
+
+GEMValueCache::GEMValueCache() {
+  reset();
+}
+
+bool GEMValueCache::lookup(const void* menuItem, byte linkedType, byte precision, const void* value, char*& valueString) {
+  byte size;
+  switch (linkedType) {
+    case GEM_VAL_INTEGER:
+      size = sizeof(int);
+      break;
+    case GEM_VAL_BYTE:
+      size = sizeof(byte);
+      break;
+    case GEM_VAL_FLOAT:
+      size = sizeof(float);
+      break;
+    case GEM_VAL_DOUBLE:
+      size = sizeof(double);
+      break;
+    case GEM_VAL_FIXED:
+      size = sizeof(int32_t);
+      break;
+    default:
+      return false;
+  }
+  for (byte i = 0; i < GEM_VALUE_CACHE_SIZE; i++) {
+    GEMValueCacheEntry& entry = _entries[i];
+    if (entry.menuItem == menuItem) {
+      valueString = entry.valueString;
+      if (entry.linkedType == linkedType && entry.precision == precision && memcmp(entry.value, value, size) == 0) {
+        return true;
+      }
+      // Value has changed since it was formatted the last time: reuse the entry
+      entry.linkedType = linkedType;
+      entry.precision = precision;
+      memcpy(entry.value, value, size);
+      return false;
+    }
+  }
+  GEMValueCacheEntry& entry = _entries[_next];
+  _next = (_next + 1) % GEM_VALUE_CACHE_SIZE;
+  entry.menuItem = menuItem;
+  entry.linkedType = linkedType;
+  entry.precision = precision;
+  memcpy(entry.value, value, size);
+  valueString = entry.valueString;
+  return false;
+}
+
+GEMValueCache& GEMValueCache::reset() {
+  memset(_entries, 0, sizeof(_entries));
+  _next = 0;
+  return *this;
+}
+
+#endif
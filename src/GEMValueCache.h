@@ -0,0 +1,82 @@
+/*
+  GEMValueCache - cache of formatted values of menu items for GEM library.
+
+  GEM (a.k.a. Good Enough Menu) - Arduino library for creation of graphic multi-level menu with
+  editable menu items, such as variables (supports int, byte, float, double, bool, char[17] data types)
+  and option selects. User-defined callback function can be specified to invoke when menu item is saved.
+  
+  Supports buttons that can invoke user-defined actions and create action-specific
+  context, which can have its own enter (setup) and exit callbacks as well as loop function.
+
+  Supports:
+  - AltSerialGraphicLCD library by Jon Green (http://www.jasspa.com/serialGLCD.html);
+  - U8g2 library by olikraus (https://github.com/olikraus/U8g2_Arduino);
+  - Adafruit GFX library by Adafruit (https://github.com/adafruit/Adafruit-GFX-Library).
+
+  For documentation visit:
+  https://github.com/Spirik/GEM
+
+  Copyright (c) 2018-2026 Alexander 'Spirik' Spiridonov
+
+  This file is part of GEM library.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+  
+  You should have received a copy of the GNU Lesser General Public License
+  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef HEADER_GEMVALUECACHE
+#define HEADER_GEMVALUECACHE
+
+#include <Arduino.h>
+#include "config.h"
+#include "constants.h"
+
+#ifdef GEM_ENABLE_VALUE_CACHE
+
+// Macro constant (alias) for the number of menu items formatted values of which are cached (can be redefined via compiler flag)
+#ifndef GEM_VALUE_CACHE_SIZE
+#define GEM_VALUE_CACHE_SIZE 8
+#endif
+
+// Declaration of GEMValueCacheEntry type
+struct GEMValueCacheEntry {
+  const void* menuItem;           // Menu item formatted value of which is stored (nullptr if entry is empty)
+  byte linkedType;                // Type of the value (type of the associated variable, or type of spinner's variable)
+  byte precision;                 // Precision the value was formatted with
+  byte value[sizeof(double)];     // Raw value the string was formatted from
+  char valueString[GEM_STR_LEN];  // Formatted value
+};
+
+// Declaration of GEMValueCache class
+class GEMValueCache {
+  public:
+    GEMValueCache();
+    /*
+      Look up formatted value of the menu item
+      @param 'menuItem' - pointer to menu item
+      @param 'linkedType' - type of the value (GEM_VAL_INTEGER, GEM_VAL_BYTE, GEM_VAL_FLOAT or GEM_VAL_DOUBLE)
+      @param 'precision' - precision of the value (for float and double values)
+      @param 'value' - pointer to the value
+      @param 'valueString' - set to the buffer holding formatted value (if returns true) or to the buffer value should be formatted into (if returns false)
+    */
+    bool lookup(const void* menuItem, byte linkedType, byte precision, const void* value, char*& valueString);
+    GEMValueCache& reset();           // Discard all of the cached values
+  protected:
+    GEMValueCacheEntry _entries[GEM_VALUE_CACHE_SIZE];
+    byte _next = 0;                   // Index of the entry to be replaced next
+};
+
+#endif
+
+#endif
@@ -39,24 +39,6 @@
 
 #include "sprites/sprites-adafruit-gfx-default.h"
 
-// AVR-based Arduinos have suppoort for dtostrf, some others may require manual inclusion (e.g. SAMD),
-// see https://github.com/plotly/arduino-api/issues/38#issuecomment-108987647
-#if defined(GEM_SUPPORT_FLOAT_EDIT) && (defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52840))
-#include <avr/dtostrf.h>
-#endif
-
-// Macro constants (aliases) for some of the ASCII character codes
-#define GEM_CHAR_CODE_9 57
-#define GEM_CHAR_CODE_0 48
-#define GEM_CHAR_CODE_MINUS 45
-#define GEM_CHAR_CODE_DOT 46
-#define GEM_CHAR_CODE_SPACE 32
-#define GEM_CHAR_CODE_UNDERSCORE 95
-#define GEM_CHAR_CODE_TILDA 126
-#define GEM_CHAR_CODE_BANG 33
-#define GEM_CHAR_CODE_a 97
-#define GEM_CHAR_CODE_ACCENT 96
-
 // Sprite of the default GEM _splash screen (GEM logo v1)
 /*
 #define logo_width  12
@@ -101,12 +83,10 @@ GEM_adafruit_gfx::GEM_adafruit_gfx(Adafruit_GFX& agfx_, byte menuPointerType_, b
   _appearance.menuValuesLeftOffset = menuValuesLeftOffset_;
   _appearance.sprites = sprites_;
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo[_spriteSize > 1 ? 1 : 0];
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->attachView(_view);
 }
 
 GEM_adafruit_gfx::GEM_adafruit_gfx(Adafruit_GFX& agfx_, GEMAppearance appearance_)
@@ -114,42 +94,52 @@ GEM_adafruit_gfx::GEM_adafruit_gfx(Adafruit_GFX& agfx_, GEMAppearance appearance
   , _appearance(appearance_)
 {
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo[_spriteSize > 1 ? 1 : 0];
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->attachView(_view);
 }
 
 //====================== APPEARANCE OPERATIONS
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::setAppearance(GEMAppearance appearance) {
   _appearance = appearance;
+  updateLayout();
+  _drawnMenuPage = nullptr;
   return *this;
 }
 
 GEMAppearance* GEM_adafruit_gfx::getCurrentAppearance() {
-  return (_menuPageCurrent != nullptr && _menuPageCurrent->_appearance != nullptr) ? _menuPageCurrent->_appearance : &_appearance;
+  return (_controller->menuPageCurrent != nullptr && _controller->menuPageCurrent->_appearance != nullptr) ? _controller->menuPageCurrent->_appearance : &_appearance;
+}
+
+void GEM_adafruit_gfx::updateLayout() {
+  GEMAppearance* appearance = getCurrentAppearance();
+  byte menuItemFontSize = appearance->menuItemHeight >= _menuItemFont[0].height * _textSize ? 0 : 1;
+  _layout.appearance = appearance;
+  _layout.menuItemsPerScreen = appearance->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_agfx.height() - appearance->menuPageScreenTopOffset) / appearance->menuItemHeight : appearance->menuItemsPerScreen;
+  _layout.menuItemFontSize = menuItemFontSize;
+  _layout.menuItemTitleLength = (appearance->menuValuesLeftOffset - 5 * _textSize) / (_menuItemFont[menuItemFontSize].width * _textSize);
+  _layout.menuItemValueLength = (_agfx.width() - appearance->menuValuesLeftOffset - 6 * _textSize) / (_menuItemFont[menuItemFontSize].width * _textSize);
+  _layout.menuItemInsetOffset = (appearance->menuItemHeight - _menuItemFont[menuItemFontSize].height * _textSize) / 2 - 1 * _textSize;
 }
 
 byte GEM_adafruit_gfx::getMenuItemsPerScreen() {
-  return getCurrentAppearance()->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_agfx.height() - getCurrentAppearance()->menuPageScreenTopOffset) / getCurrentAppearance()->menuItemHeight : getCurrentAppearance()->menuItemsPerScreen;
+  return _layout.menuItemsPerScreen;
 }
 
 byte GEM_adafruit_gfx::getMenuItemFontSize() {
-  return getCurrentAppearance()->menuItemHeight >= _menuItemFont[0].height * _textSize ? 0 : 1;
+  return _layout.menuItemFontSize;
 }
 
 byte GEM_adafruit_gfx::getMenuItemTitleLength() {
-  return (getCurrentAppearance()->menuValuesLeftOffset - 5 * _textSize) / (_menuItemFont[getMenuItemFontSize()].width * _textSize);
+  return _layout.menuItemTitleLength;
 }
 
 byte GEM_adafruit_gfx::getMenuItemValueLength() {
-  return (_agfx.width() - getCurrentAppearance()->menuValuesLeftOffset - 6 * _textSize) / (_menuItemFont[getMenuItemFontSize()].width * _textSize);
+  return _layout.menuItemValueLength;
 }
 
-
 //====================== INIT OPERATIONS
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::setSplash(byte width, byte height, const uint8_t *image) {
@@ -175,6 +165,7 @@ GEM_adafruit_gfx& GEM_adafruit_gfx::hideVersion(bool flag) {
 GEM_adafruit_gfx& GEM_adafruit_gfx::setTextSize(uint8_t size) {
   _textSize = size > 0 ? size : 1;
   setSpriteSize(_textSize);
+  updateLayout();
   return *this;
 }
 
@@ -189,12 +180,14 @@ GEM_adafruit_gfx& GEM_adafruit_gfx::setSpriteSize(uint8_t size) {
 GEM_adafruit_gfx& GEM_adafruit_gfx::setFontBig(const GFXfont* font, uint8_t width, uint8_t height, uint8_t baselineOffset) {
   _fontFamilies.big = font;
   _menuItemFont[0] = {width, height, baselineOffset};
+  updateLayout();
   return *this;
 }
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::setFontSmall(const GFXfont* font, uint8_t width, uint8_t height, uint8_t baselineOffset) {
   _fontFamilies.small = font;
   _menuItemFont[1] = {width, height, baselineOffset};
+  updateLayout();
   return *this;
 }
 
@@ -209,59 +202,135 @@ GEM_adafruit_gfx& GEM_adafruit_gfx::setBackgroundColor(uint16_t color) {
 }
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::invertKeysDuringEdit(bool invert) {
-  _invertKeysDuringEdit = invert;
+  _controller->_invertKeysDuringEdit = invert;
   return *this;
 }
 
-GEM_adafruit_gfx& GEM_adafruit_gfx::init() {
-  _agfx.setTextSize(_textSize);
-  _agfx.setTextWrap(false);
-  _agfx.setTextColor(_menuForegroundColor);
-  _agfx.fillScreen(_menuBackgroundColor);
+GEM_adafruit_gfx& GEM_adafruit_gfx::setCharAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_charAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
 
-  if (_splashDelay > 0) {
+GEM_adafruit_gfx& GEM_adafruit_gfx::setDigitAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_digitAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
 
-    _agfx.drawBitmap((_agfx.width() - _splash.width) / 2, (_agfx.height() - _splash.height) / 2, _splash.image, _splash.width, _splash.height, _menuForegroundColor);
+GEM_adafruit_gfx& GEM_adafruit_gfx::enableDeferredDrawing(bool flag) {
+  _deferredDrawing = flag;
+  if (!_deferredDrawing) {
+    flushPendingDraw();
+  }
+  return *this;
+}
 
+GEM_adafruit_gfx& GEM_adafruit_gfx::setMaxFrameRate(byte fps) {
+  _maxFrameRate = fps;
+  return *this;
+}
+
+GEM_adafruit_gfx& GEM_adafruit_gfx::init() {
+  initAsync();
+  if (_splashState != GEM_SPLASH_NONE) {
     if (_enableVersion) {
       delay(_splashDelay / 2);
-      _agfx.setFont(_fontFamilies.small);
-      byte x = _agfx.width() - strlen(GEM_VER) * 4 * _textSize;
-      byte y = _agfx.height() - 1;
-      if (_splash.image != logo[0].image && _splash.image != logo[1].image) {
-        _agfx.setCursor(x - 12 * _textSize, y);
-        _agfx.print("GEM");
-      } else {
-        _agfx.setCursor(x, y);
-      }
-      _agfx.print(GEM_VER);
+      drawSplashVersion();
       delay(_splashDelay / 2);
     } else {
       delay(_splashDelay);
     }
+    finishSplash();
+  }
+  return *this;
+}
 
-    _agfx.fillScreen(_menuBackgroundColor);
+GEM_adafruit_gfx& GEM_adafruit_gfx::initAsync() {
+  updateLayout();
+  _agfx.setTextSize(_textSize);
+  _agfx.setTextWrap(false);
+  _agfx.setTextColor(_menuForegroundColor);
+  _agfx.fillScreen(_menuBackgroundColor);
 
+  _splashState = GEM_SPLASH_NONE;
+  if (_splashDelay > 0) {
+    _agfx.drawBitmap((_agfx.width() - _splash.width) / 2, (_agfx.height() - _splash.height) / 2, _splash.image, _splash.width, _splash.height, _menuForegroundColor);
+    _splashState = GEM_SPLASH_LOGO;
+    _splashStart = millis();
   }
 
+  _drawnMenuPage = nullptr;
   return *this;
 }
 
+bool GEM_adafruit_gfx::poll() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    unsigned long elapsed = millis() - _splashStart;
+    if (elapsed >= _splashDelay) {
+      dismissSplash();
+    } else if (_splashState == GEM_SPLASH_LOGO && _enableVersion && elapsed >= _splashDelay / 2) {
+      drawSplashVersion();
+      _splashState = GEM_SPLASH_VERSION;
+    }
+  }
+  return _splashState != GEM_SPLASH_NONE;
+}
+
+void GEM_adafruit_gfx::dismissSplash() {
+  finishSplash();
+  if (_controller->menuPageCurrent != nullptr) {
+    drawMenu();
+  }
+}
+
+void GEM_adafruit_gfx::drawSplashVersion() {
+  _agfx.setFont(_fontFamilies.small);
+  byte x = _agfx.width() - strlen(GEM_VER) * 4 * _textSize;
+  byte y = _agfx.height() - 1;
+  if (_splash.image != logo[0].image && _splash.image != logo[1].image) {
+    _agfx.setCursor(x - 12 * _textSize, y);
+    _agfx.print("GEM");
+  } else {
+    _agfx.setCursor(x, y);
+  }
+  _agfx.print(GEM_VER);
+}
+
+void GEM_adafruit_gfx::finishSplash() {
+  _splashState = GEM_SPLASH_NONE;
+  _agfx.fillScreen(_menuBackgroundColor);
+}
+
 GEM_adafruit_gfx& GEM_adafruit_gfx::reInit() {
+  updateLayout();
   _agfx.setTextSize(_textSize);
   _agfx.setTextWrap(false);
   _agfx.setTextColor(_menuForegroundColor);
   _agfx.fillScreen(_menuBackgroundColor);
+  _drawnMenuPage = nullptr;
   return *this;
 }
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::setMenuPageCurrent(GEMPage& menuPageCurrent) {
-  _menuPageCurrent = &menuPageCurrent;
+  _controller->setMenuPageCurrent(menuPageCurrent);
+  updateLayout();
   return *this;
 }
 
 GEMPage* GEM_adafruit_gfx::getCurrentMenuPage() {
-  return _menuPageCurrent;
+  return _controller->menuPageCurrent;
+}
+
+GEM_adafruit_gfx& GEM_adafruit_gfx::setController(GEMController& controller) {
+  _controller->detachView(_view);
+  _controller = &controller;
+  _view = GEMView(); // Nothing pending for the previous controller (changed parts, dirty range, position of the edit cursor) applies to the new one
+  _controller->attachView(_view);
+  _view.dirty = GEM_DIRTY_MENU;
+  return *this;
+}
+
+GEMController& GEM_adafruit_gfx::getController() {
+  return *_controller;
 }
 
 //====================== CONTEXT OPERATIONS
@@ -277,17 +346,210 @@ GEM_adafruit_gfx& GEM_adafruit_gfx::clearContext() {
 //====================== DRAW OPERATIONS
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::drawMenu() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Menu is drawn once splash screen is dismissed
+    return *this;
+  }
+  updateLayout();
+  GEM_PROFILE_FRAME_BEGIN();
   _agfx.fillScreen(_menuBackgroundColor);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_TITLE);
   drawTitleBar();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_ITEMS);
   printMenuItems();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_POINTER);
   drawMenuPointer();
+  if (_controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+    drawEditValue();
+  }
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_SCROLLBAR);
   drawScrollbar();
+  GEM_PROFILE_PHASE_END();
   if (drawMenuCallback != nullptr) {
+    GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_CALLBACK);
     drawMenuCallback();
+    GEM_PROFILE_PHASE_END();
   }
+  storeDrawnState();
+  _view.dirty = 0; // Everything is drawn anew
+  GEM_PROFILE_FRAME_END();
   return *this;
 }
 
+GEM_adafruit_gfx& GEM_adafruit_gfx::updateMenu() {
+  updateLayout();
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  if (_controller->menuPageCurrent != _drawnMenuPage || menuItemsPerScreen > sizeof(_dirtyRows) * 8) {
+    return drawMenu();
+  }
+  GEM_PROFILE_FRAME_BEGIN();
+  GEMIndex currentScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+  for (byte i = 0; i < menuItemsPerScreen; i++) {
+    if (_view.areMenuItemsDirty(currentScreenNum * menuItemsPerScreen + i, 1)) {
+      invalidateMenuRow(i);
+    }
+  }
+  _view.dirty &= ~GEM_DIRTY_ITEMS;
+  byte currentRow = _controller->menuPageCurrent->currentItemNum % menuItemsPerScreen;
+  uint32_t currentRowMask = (uint32_t)1 << currentRow;
+  bool rowPointer = _layout.appearance->menuPointerType != GEM_POINTER_DASH;
+  bool redrawScreen = (currentScreenNum != _drawnScreenNum);
+  bool pointerMoved = redrawScreen || (_controller->menuPageCurrent->currentItemNum != _drawnItemNum);
+  byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
+
+  if (redrawScreen) {
+    // Title bar stays the same while scrolling through the screens of the same page
+    _agfx.fillRect(0, menuPageScreenTopOffset - 1, _agfx.width(), _agfx.height() - menuPageScreenTopOffset + 1, _menuBackgroundColor);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+    _dirtyRows = ~(uint32_t)0;
+  } else if (pointerMoved && rowPointer) {
+    invalidateMenuRow(_drawnItemNum % menuItemsPerScreen);
+    invalidateMenuRow(currentRow);
+  }
+  // Highlighted row overlaps neighbouring rows by one pixel, hence should be redrawn (last) if any of them is cleared
+  if (rowPointer && (_dirtyRows & ((currentRowMask << 1) | (currentRowMask >> 1)))) {
+    _dirtyRows |= currentRowMask;
+  }
+  if (_controller->editValueMode) {
+    _dirtyRows &= ~currentRowMask;
+  }
+
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_ITEMS);
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(currentScreenNum * menuItemsPerScreen);
+  byte y = menuPageScreenTopOffset;
+  for (byte i = 0; i < menuItemsPerScreen; i++) {
+    if ((_dirtyRows & ((uint32_t)1 << i)) && !(rowPointer && i == currentRow)) {
+      if (!redrawScreen) {
+        clearMenuRow(i);
+      }
+      if (menuItemTmp != nullptr) {
+        byte yDraw = y + getMenuItemInsetOffset();
+        byte yText = yDraw + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize;
+        printMenuItem(menuItemTmp, yText, yDraw, _menuForegroundColor);
+      }
+    }
+    if (menuItemTmp != nullptr) {
+      menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    }
+    y += _layout.appearance->menuItemHeight;
+  }
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_POINTER);
+  if (rowPointer ? (_dirtyRows & currentRowMask) : (pointerMoved && !_controller->editValueMode)) {
+    drawMenuPointer();
+  }
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_SCROLLBAR);
+  if (redrawScreen) {
+    drawScrollbar();
+  } else if (_controller->menuPageCurrent->itemsCount != _drawnItemsCount) {
+    _agfx.fillRect(_agfx.width() - 1, menuPageScreenTopOffset - 1, 1, _agfx.height() - menuPageScreenTopOffset + 1, _menuBackgroundColor);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+    drawScrollbar();
+  }
+  GEM_PROFILE_PHASE_END();
+  if (redrawScreen && drawMenuCallback != nullptr) {
+    GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_CALLBACK);
+    drawMenuCallback();
+    GEM_PROFILE_PHASE_END();
+  }
+  storeDrawnState();
+  GEM_PROFILE_FRAME_END();
+  return *this;
+}
+
+GEM_adafruit_gfx& GEM_adafruit_gfx::invalidateMenuItem(GEMItem& menuItem, bool following) {
+  _controller->invalidateMenuItem(menuItem, following);
+  return *this;
+}
+
+GEM_adafruit_gfx& GEM_adafruit_gfx::drawPending() {
+  if (_view.dirty != 0 && (_maxFrameRate == 0 || millis() - _lastFrameTime >= 1000 / _maxFrameRate)) {
+    flushPendingDraw();
+  }
+  return *this;
+}
+
+#ifdef GEM_ENABLE_REFRESH
+GEM_adafruit_gfx& GEM_adafruit_gfx::refresh() {
+  if (_controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    return *this;
+  }
+  flushPendingDraw();
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  GEMItem* menuItemCurrent = _controller->menuPageCurrent->getCurrentMenuItem();
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(_controller->menuPageCurrent->currentItemNum / menuItemsPerScreen * menuItemsPerScreen);
+  bool changed = false;
+  for (byte i = 0; menuItemTmp != nullptr && i < menuItemsPerScreen; i++) {
+    if (menuItemTmp->type == GEM_ITEM_VAL && !(_controller->editValueMode && menuItemTmp == menuItemCurrent) && _drawnValues.changed(menuItemTmp, menuItemTmp->getValueHash())) {
+      invalidateMenuRow(i);
+      changed = true;
+    }
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+  }
+  if (changed) {
+    updateMenu(); // Only the invalidated rows are cleared and drawn anew
+  }
+  return *this;
+}
+#endif
+
+void GEM_adafruit_gfx::flushPendingDraw() {
+  byte dirty = _view.dirty & ~GEM_DIRTY_ITEMS; // Changed menu items are drawn by updateMenu()
+  if (_view.dirty == 0 || _controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    // Nothing changed since the last frame (or menu is not displayed)
+    return;
+  }
+  #ifdef GEM_ENABLE_REFRESH
+  if (dirty & (GEM_DIRTY_EDIT | GEM_DIRTY_VALUE)) {
+    _drawnValues.invalidate(_controller->menuPageCurrent->getCurrentMenuItem()); // Value is drawn by edit mode (or toggled in place), so it is repainted by the next refresh()
+  }
+  #endif
+  GEM_PROFILE_FRAME_BEGIN();
+  if ((dirty & GEM_DIRTY_MENU) || _drawnMenuPage != _controller->menuPageCurrent) {
+    drawMenu();
+  } else if (dirty == 0 || (!_controller->editValueMode && !(dirty & GEM_DIRTY_VALUE))) {
+    if (dirty & GEM_DIRTY_EDIT) {
+      // Row of the menu item which edit was exited is drawn anew (with the saved value)
+      invalidateMenuRow(_drawnItemNum % getMenuItemsPerScreen());
+    }
+    updateMenu(); // Pointer is moved straight from the drawn menu item to the current one
+  } else if (dirty == GEM_DIRTY_VALUE && !_controller->editValueMode) {
+    drawCheckbox();
+  } else if (dirty == GEM_DIRTY_EDIT && _controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+    drawEditValue();
+  } else if (_controller->editValueMode && !(dirty & (GEM_DIRTY_POINTER | GEM_DIRTY_EDIT))) {
+    if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+      drawEditValueSelect();
+    } else {
+      moveEditValueCursor(dirty);
+    }
+  } else {
+    drawMenu();
+  }
+  if (_view.dirty & GEM_DIRTY_ITEMS) {
+    updateMenu(); // Menu items changed while value of the current one was being edited (or toggled)
+  }
+  _view.dirty = 0;
+  GEM_PROFILE_FRAME_END();
+  _lastFrameTime = millis();
+}
+
+void GEM_adafruit_gfx::storeDrawnState() {
+  _drawnMenuPage = _controller->menuPageCurrent;
+  _drawnScreenNum = _controller->menuPageCurrent->currentItemNum / getMenuItemsPerScreen();
+  _drawnItemNum = _controller->menuPageCurrent->currentItemNum;
+  _drawnItemsCount = _controller->menuPageCurrent->itemsCount;
+  _dirtyRows = 0;
+}
+
+void GEM_adafruit_gfx::invalidateMenuRow(byte row, bool following) {
+  if (row < sizeof(_dirtyRows) * 8) {
+    _dirtyRows |= following ? ~(uint32_t)0 << row : (uint32_t)1 << row;
+  }
+}
+
 GEM_adafruit_gfx& GEM_adafruit_gfx::setDrawMenuCallback(void (*drawMenuCallback_)()) {
   drawMenuCallback = drawMenuCallback_;
   return *this;
@@ -303,7 +565,12 @@ void GEM_adafruit_gfx::drawTitleBar() {
   _agfx.setTextWrap(true);
   _agfx.setTextColor(_menuForegroundColor);
   _agfx.setCursor(5 * _textSize, _menuItemFont[1].baselineOffset * _textSize + 1);
-  _agfx.print(_menuPageCurrent->title);
+  if (_controller->menuPageCurrent->titleProgmem) {
+    _agfx.print(reinterpret_cast<const __FlashStringHelper*>(_controller->menuPageCurrent->title));
+  } else {
+    _agfx.print(_controller->menuPageCurrent->title);
+  }
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, GEMFormat::length(_controller->menuPageCurrent->title, _controller->menuPageCurrent->titleProgmem));
   _agfx.setTextWrap(false);
   _agfx.setFont(getMenuItemFontSize() ? _fontFamilies.small : _fontFamilies.big);
 }
@@ -312,7 +579,7 @@ GEMSprite* GEM_adafruit_gfx::getSprite(byte spriteId) {
   GEMSprite* sprite = nullptr;
   byte len = sizeof(spritesDefault_adafruit_gfx)/sizeof(spritesDefault_adafruit_gfx[0]);
   if (spriteId < len) {
-    void* pSprites = getCurrentAppearance()->sprites == nullptr ? spritesDefault_adafruit_gfx : getCurrentAppearance()->sprites;
+    void* pSprites = _layout.appearance->sprites == nullptr ? spritesDefault_adafruit_gfx : _layout.appearance->sprites;
     byte variant = _spriteSize - 1;
     GEMSprite* (*pSpritesCast)[2] = static_cast<GEMSprite* (*)[2]>(pSprites);
     sprite = pSpritesCast[spriteId][variant];
@@ -331,6 +598,7 @@ void GEM_adafruit_gfx::drawSprite(int16_t x, int16_t y, byte spriteId, uint16_t
       byte menuItemFontSize = getMenuItemFontSize();
       int offset = withInsetOffset ? 1 * _textSize + (_menuItemFont[menuItemFontSize].height * _textSize - sprite->height) / 2 : 0; // With additional offset for centered vertical alignment with text
       _agfx.drawBitmap(x, y + offset, sprite->image, sprite->width, sprite->height, color);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_BITMAP, 1);
     }
   }
 }
@@ -345,34 +613,52 @@ GEM_adafruit_gfx& GEM_adafruit_gfx::removeDrawSpriteCallback() {
   return *this;
 }
 
-void GEM_adafruit_gfx::printMenuItemString(const char* str, byte num, byte startPos) {
+#ifdef GEM_ENABLE_PROFILING
+GEMProfiler& GEM_adafruit_gfx::getProfiler() {
+  return _profiler;
+}
+#endif
+
+void GEM_adafruit_gfx::printMenuItemString(const char* str, byte num, byte startPos, bool progmem) {
   byte i = startPos;
-  while (i < num + startPos && str[i] != '\0') {
-    _agfx.print(str[i]);
+  char c;
+  while (i < num + startPos && (c = GEMFormat::readChar(str, i, progmem)) != '\0') {
+    _agfx.print(c);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
     i++;
   }
 }
 
-void GEM_adafruit_gfx::printMenuItemTitle(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + offset);
+void GEM_adafruit_gfx::printMenuItemTitle(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + offset, 0, progmem);
 }
 
-void GEM_adafruit_gfx::printMenuItemValue(const char* str, int offset, byte startPos) {
-  printMenuItemString(str, getMenuItemValueLength() + offset, startPos);
+void GEM_adafruit_gfx::printMenuItemValue(const char* str, int offset, byte startPos, bool progmem) {
+  printMenuItemString(str, getMenuItemValueLength() + offset, startPos, progmem);
 }
 
-void GEM_adafruit_gfx::printMenuItemFull(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset);
+char* GEM_adafruit_gfx::formatMenuItemValue(GEMItem* menuItemTmp, byte linkedType, char* valueStringTmp) {
+  char* valueString = valueStringTmp;
+  #ifdef GEM_ENABLE_VALUE_CACHE
+  byte precision = (linkedType == GEM_VAL_FIXED) ? ((GEMFixed*)menuItemTmp->linkedVariable)->precision : menuItemTmp->precision;
+  if (_valueCache.lookup(menuItemTmp, linkedType, precision, menuItemTmp->linkedVariable, valueString)) {
+    // Value hasn't changed since it was formatted the last time
+    return valueString;
+  }
+  #endif
+  return GEMFormat::formatValue(menuItemTmp->linkedVariable, linkedType, menuItemTmp->precision, valueString);
+}
+
+void GEM_adafruit_gfx::printMenuItemFull(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset, 0, progmem);
 }
 
 byte GEM_adafruit_gfx::getMenuItemInsetOffset() {
-  byte menuItemFontSize = getMenuItemFontSize();
-  byte menuItemInsetOffset = (getCurrentAppearance()->menuItemHeight - _menuItemFont[menuItemFontSize].height * _textSize) / 2 - 1 * _textSize;
-  return menuItemInsetOffset;
+  return _layout.menuItemInsetOffset;
 }
 
 byte GEM_adafruit_gfx::getCurrentItemTopOffset(bool withInsetOffset) {
-  return (_menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * getCurrentAppearance()->menuItemHeight + getCurrentAppearance()->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
+  return (_controller->menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * _layout.appearance->menuItemHeight + _layout.appearance->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
 }
 
 byte GEM_adafruit_gfx::calculateSpriteOverlap(byte spriteId) {
@@ -386,23 +672,22 @@ void GEM_adafruit_gfx::printMenuItem(GEMItem* menuItemTmp, byte yText, byte yDra
     case GEM_ITEM_VAL:
       {
         _agfx.setCursor(5 * _textSize, yText);
-        if (menuItemTmp->readonly) {
-          printMenuItemTitle(menuItemTmp->title, -1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemTitle(menuItemTmp->title, -1, menuItemTmp->flags.titleProgmem);
           _agfx.print("^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemTitle(menuItemTmp->title);
+          printMenuItemTitle(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
         }
 
-        byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
+        byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
         _agfx.setCursor(menuValuesLeftOffset, yText);
         switch (menuItemTmp->linkedType) {
           case GEM_VAL_INTEGER:
-            itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-            printMenuItemValue(valueStringTmp);
+            printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_INTEGER, valueStringTmp));
             break;
           case GEM_VAL_BYTE:
-            itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-            printMenuItemValue(valueStringTmp);
+            printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_BYTE, valueStringTmp));
             break;
           case GEM_VAL_CHAR:
             printMenuItemValue((char*)menuItemTmp->linkedVariable);
@@ -417,7 +702,7 @@ void GEM_adafruit_gfx::printMenuItem(GEMItem* menuItemTmp, byte yText, byte yDra
           case GEM_VAL_SELECT:
             {
               GEMSelect* select = menuItemTmp->select;
-              printMenuItemValue(select->getSelectedOptionName(menuItemTmp->linkedVariable), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+              printMenuItemValue(select->getOptionNameByIndex(menuItemTmp->getSelectedOptionNum()), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
               drawSprite(_agfx.width() - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1 * _spriteSize, yDraw, GEM_ICON_SELECT_ARROWS, color, menuItemTmp);
             }
             break;
@@ -425,49 +710,36 @@ void GEM_adafruit_gfx::printMenuItem(GEMItem* menuItemTmp, byte yText, byte yDra
           case GEM_VAL_SPINNER:
             {
               GEMSpinner* spinner = menuItemTmp->spinner;
-              switch (spinner->getType()) {
-                case GEM_VAL_BYTE:
-                  itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                  break;
-                case GEM_VAL_INTEGER:
-                  itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                  break;
-                #ifdef GEM_SUPPORT_FLOAT_EDIT
-                case GEM_VAL_FLOAT:
-                  dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                  break;
-                case GEM_VAL_DOUBLE:
-                  dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                  break;
-                #endif
-              }
-              printMenuItemValue(valueStringTmp, -1 * calculateSpriteOverlap(GEM_ICON_SPINNER_ARROWS));
+              printMenuItemValue(formatMenuItemValue(menuItemTmp, spinner->getType(), valueStringTmp), -1 * calculateSpriteOverlap(GEM_ICON_SPINNER_ARROWS));
               drawSprite(_agfx.width() - getSprite(GEM_ICON_SPINNER_ARROWS)->width - 1 * _spriteSize, yDraw, GEM_ICON_SPINNER_ARROWS, color, menuItemTmp);
             }
             break;
           #endif
+          case GEM_VAL_FIXED:
+            printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FIXED, valueStringTmp));
+            break;
           #ifdef GEM_SUPPORT_FLOAT_EDIT
           case GEM_VAL_FLOAT:
-            // sprintf(valueStringTmp,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-            dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-            printMenuItemValue(valueStringTmp);
+            printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FLOAT, valueStringTmp));
             break;
           case GEM_VAL_DOUBLE:
-            // sprintf(valueStringTmp,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-            dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-            printMenuItemValue(valueStringTmp);
+            printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_DOUBLE, valueStringTmp));
             break;
           #endif
         }
+        #ifdef GEM_ENABLE_REFRESH
+        _drawnValues.store(menuItemTmp, menuItemTmp->getValueHash()); // Edited menu item is skipped by refresh(), and its value is invalidated when edit mode is exited
+        #endif
         break;
       }
     case GEM_ITEM_LINK:
       _agfx.setCursor(5 * _textSize, yText);
-      if (menuItemTmp->readonly) {
-        printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1);
+      if (menuItemTmp->flags.readonly) {
+        printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1, menuItemTmp->flags.titleProgmem);
         _agfx.print("^");
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
       } else {
-        printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT));
+        printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT), menuItemTmp->flags.titleProgmem);
       }
       drawSprite(_agfx.width() - getSprite(GEM_ICON_ARROW_RIGHT)->width - 2 * _spriteSize, yDraw, GEM_ICON_ARROW_RIGHT, color, menuItemTmp);
       break;
@@ -478,18 +750,19 @@ void GEM_adafruit_gfx::printMenuItem(GEMItem* menuItemTmp, byte yText, byte yDra
       {
         byte variant = _spriteSize > 1 ? 1 : 0;
         _agfx.setCursor((5 * _textSize + getSprite(GEM_ICON_ARROW_BTN)->width + 2 * variant), yText);
-        if (menuItemTmp->readonly) {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1, menuItemTmp->flags.titleProgmem);
           _agfx.print("^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN));
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN), menuItemTmp->flags.titleProgmem);
         }
         drawSprite(5 * _textSize + 2 * variant, yDraw, GEM_ICON_ARROW_BTN, color, menuItemTmp);
         break;
       }
     case GEM_ITEM_LABEL:
       _agfx.setCursor(5 * _textSize, yText);
-      printMenuItemFull(menuItemTmp->title);
+      printMenuItemFull(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
       break;
   }
   memset(valueStringTmp, '\0', GEM_STR_LEN - 1);
@@ -498,9 +771,9 @@ void GEM_adafruit_gfx::printMenuItem(GEMItem* menuItemTmp, byte yText, byte yDra
 
 void GEM_adafruit_gfx::printMenuItems() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte currentPageScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-  GEMItem* menuItemTmp = _menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
-  byte y = getCurrentAppearance()->menuPageScreenTopOffset;
+  GEMIndex currentPageScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
+  byte y = _layout.appearance->menuPageScreenTopOffset;
   byte i = 0;
   while (menuItemTmp != nullptr && i < menuItemsPerScreen) {
     byte yDraw = y + getMenuItemInsetOffset();
@@ -508,50 +781,62 @@ void GEM_adafruit_gfx::printMenuItems() {
 
     printMenuItem(menuItemTmp, yText, yDraw, _menuForegroundColor);
 
-    menuItemTmp = menuItemTmp->getMenuItemNext();
-    y += getCurrentAppearance()->menuItemHeight;
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    y += _layout.appearance->menuItemHeight;
     i++;
   }
 }
 
 void GEM_adafruit_gfx::drawMenuPointer(bool clear) {
-  if (_menuPageCurrent->itemsCount > 0) {
-    GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
+  if (_controller->menuPageCurrent->itemsCount > 0) {
+    GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
     int pointerPosition = getCurrentItemTopOffset();
-    byte menuItemHeight = getCurrentAppearance()->menuItemHeight;
-    if (getCurrentAppearance()->menuPointerType == GEM_POINTER_DASH) {
-      byte menuPageScreenTopOffset = getCurrentAppearance()->menuPageScreenTopOffset;
+    byte menuItemHeight = _layout.appearance->menuItemHeight;
+    if (_layout.appearance->menuPointerType == GEM_POINTER_DASH) {
+      byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
       _agfx.fillRect(0, menuPageScreenTopOffset, 2 * _spriteSize, _agfx.height() - menuPageScreenTopOffset, _menuBackgroundColor);
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         for (byte i = 0; i < (menuItemHeight - 1) / 2; i++) {
           _agfx.drawPixel(0, pointerPosition + i * 2, _menuForegroundColor);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _agfx.drawPixel(1, pointerPosition + i * 2 + 1, _menuForegroundColor);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           if (_spriteSize > 1) {
             _agfx.drawPixel(2, pointerPosition + i * 2, _menuForegroundColor);
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
             _agfx.drawPixel(3, pointerPosition + i * 2 + 1, _menuForegroundColor);
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           }
         }
       } else {
         _agfx.fillRect(0, pointerPosition, 2 * _spriteSize, menuItemHeight - 1, _menuForegroundColor);
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       }
       if (clear) {
         byte yDraw = pointerPosition + getMenuItemInsetOffset();
         byte yText = yDraw + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize;
         _agfx.fillRect(5 * _spriteSize, pointerPosition - 1, _agfx.width() - 2, menuItemHeight + 1, _menuBackgroundColor);
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
         printMenuItem(menuItemTmp, yText, yDraw, _menuForegroundColor);
       }
     } else {
       byte yDraw = pointerPosition + getMenuItemInsetOffset();
       byte yText = yDraw + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize;
       _agfx.fillRect(0, pointerPosition - 1, _agfx.width() - 2, menuItemHeight + 1, clear ? _menuBackgroundColor : _menuForegroundColor);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       printMenuItem(menuItemTmp, yText, yDraw, clear ? _menuForegroundColor : _menuBackgroundColor);
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         for (byte i = 0; i < (menuItemHeight + 2) / 2; i++) {
           _agfx.drawPixel(0, pointerPosition + i * 2, _menuBackgroundColor);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _agfx.drawPixel(1, pointerPosition + i * 2 - 1, _menuBackgroundColor);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           if (_spriteSize > 1) {
             _agfx.drawPixel(2, pointerPosition + i * 2, _menuBackgroundColor);
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
             _agfx.drawPixel(3, pointerPosition + i * 2 - 1, _menuBackgroundColor);
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           }
         }
       }
@@ -559,530 +844,163 @@ void GEM_adafruit_gfx::drawMenuPointer(bool clear) {
   }
 }
 
+void GEM_adafruit_gfx::clearMenuRow(byte row) {
+  byte x = (_layout.appearance->menuPointerType == GEM_POINTER_DASH) ? 2 * _spriteSize : 0;
+  byte menuItemHeight = _layout.appearance->menuItemHeight;
+  int y = row * menuItemHeight + _layout.appearance->menuPageScreenTopOffset;
+  _agfx.fillRect(x, y - 1, _agfx.width() - 2 - x, menuItemHeight + 1, _menuBackgroundColor);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+}
+
 void GEM_adafruit_gfx::drawScrollbar() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte screensCount = (_menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _menuPageCurrent->itemsCount / menuItemsPerScreen : _menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
+  GEMIndex screensCount = (_controller->menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _controller->menuPageCurrent->itemsCount / menuItemsPerScreen : _controller->menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
   if (screensCount > 1) {
-    byte currentScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-    byte menuPageScreenTopOffset = getCurrentAppearance()->menuPageScreenTopOffset;
-    byte scrollbarHeight = (_agfx.height() - menuPageScreenTopOffset + 1) / screensCount;
-    byte scrollbarPosition = currentScreenNum * scrollbarHeight + menuPageScreenTopOffset - 1;
+    GEMIndex currentScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+    byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
+    int scrollbarSpace = _agfx.height() - menuPageScreenTopOffset + 1;
+    // When there are more screens than pixels available, scrollbar is kept 1px high and its position is scaled instead
+    byte scrollbarHeight = (screensCount <= scrollbarSpace) ? scrollbarSpace / screensCount : 1;
+    int scrollbarPosition = ((screensCount <= scrollbarSpace) ? currentScreenNum * scrollbarHeight : (long)currentScreenNum * (scrollbarSpace - 1) / (screensCount - 1)) + menuPageScreenTopOffset - 1;
     _agfx.drawLine(_agfx.width() - 1, scrollbarPosition, _agfx.width() - 1, scrollbarPosition + scrollbarHeight, _menuForegroundColor);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_LINE, 1);
   }
 }
 
 //====================== MENU ITEMS NAVIGATION
 
-void GEM_adafruit_gfx::nextMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-      drawMenuPointer(true);
-    }
-    if (_menuPageCurrent->currentItemNum == _menuPageCurrent->itemsCount-1) {
-      _menuPageCurrent->currentItemNum = 0;
-    } else {
-      _menuPageCurrent->currentItemNum++;
-    }
-    byte menuItemsPerScreen = getMenuItemsPerScreen();
-    bool redrawMenu = (_menuPageCurrent->itemsCount > menuItemsPerScreen && _menuPageCurrent->currentItemNum % menuItemsPerScreen == 0);
-    if (redrawMenu) {
-      drawMenu();
-    } else {
-      drawMenuPointer();
-    }
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToMenuItem(GEMIndex index) {
+  _controller->goToMenuItem(index);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::prevMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) {
-      drawMenuPointer(true);
-    }
-    byte menuItemsPerScreen = getMenuItemsPerScreen();
-    bool redrawMenu = (_menuPageCurrent->itemsCount > menuItemsPerScreen && _menuPageCurrent->currentItemNum % menuItemsPerScreen == 0);
-    if (_menuPageCurrent->currentItemNum == 0) {
-      _menuPageCurrent->currentItemNum = _menuPageCurrent->itemsCount-1;
-    } else {
-      _menuPageCurrent->currentItemNum--;
-    }
-    if (redrawMenu) {
-      drawMenu();
-    } else {
-      drawMenuPointer();
-    }
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToMenuItem(GEMItem& menuItem) {
+  _controller->goToMenuItem(menuItem);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::menuItemSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp != nullptr) {
-    switch (menuItemTmp->type) {
-      case GEM_ITEM_VAL:
-        if (!menuItemTmp->readonly) {
-          enterEditValueMode();
-        }
-        break;
-      case GEM_ITEM_LINK:
-        if (!menuItemTmp->readonly) {
-          _menuPageCurrent = menuItemTmp->linkedPage;
-          drawMenu();
-        }
-        break;
-      case GEM_ITEM_BACK:
-        _menuPageCurrent->currentItemNum = (_menuPageCurrent->itemsCount > 1) ? 1 : 0;
-        _menuPageCurrent = menuItemTmp->linkedPage;
-        drawMenu();
-        break;
-      case GEM_ITEM_BUTTON:
-        if (!menuItemTmp->readonly) {
-          if (menuItemTmp->callbackWithArgs) {
-            menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-          } else {
-            menuItemTmp->callbackAction();
-          }
-        }
-        break;
-    }
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToFirstMenuItem() {
+  _controller->goToFirstMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-//====================== VALUE EDIT
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToLastMenuItem() {
+  _controller->goToLastMenuItem();
+  flushPendingDraw();
+  return *this;
+}
 
-void GEM_adafruit_gfx::enterEditValueMode() {
-  _editValueMode = true;
-  memset(_valueString, '\0', GEM_STR_LEN - 1); // Not calling drawMenu() in exitEditValue() every time, so it's better to implement buffer cleanup here
-  
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  _editValueType = menuItemTmp->linkedType;
-  if ((getCurrentAppearance()->menuPointerType != GEM_POINTER_DASH) && (_editValueType != GEM_VAL_BOOL)) {
-    drawMenuPointer(true);
-  }
-  switch (_editValueType) {
-    case GEM_VAL_INTEGER:
-      itoa(*(int*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 6;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BYTE:
-      itoa(*(byte*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 3;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_CHAR:
-      strcpy(_valueString, (char*)menuItemTmp->linkedVariable);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BOOL:
-      checkboxToggle();
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        _valueSelectNum = select->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        _valueSelectNum = spinner->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      // sprintf(_valueString,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_DOUBLE:
-      // sprintf(_valueString,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    #endif
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToPrevScreen() {
+  _controller->goToPrevScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::checkboxToggle() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  byte menuItemFontSize = getMenuItemFontSize();
-  int topOffset = getCurrentItemTopOffset(true);
-  bool checkboxValue = *(bool*)menuItemTmp->linkedVariable;
-  *(bool*)menuItemTmp->linkedVariable = !checkboxValue;
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    if (!_editValueMode) { // Edge case e.g. when edit mode was activated from inside callback (e.g. on another menu item)
-      drawMenu();
-    }
-  } else {
-    byte menuPointerType = getCurrentAppearance()->menuPointerType;
-    uint16_t foreColor = (menuPointerType == GEM_POINTER_DASH) ? _menuForegroundColor : _menuBackgroundColor;
-    uint16_t backColor = (menuPointerType == GEM_POINTER_DASH) ? _menuBackgroundColor : _menuForegroundColor;
-    byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-    if (!checkboxValue) {
-      GEMSprite* sprite = getSprite(GEM_ICON_CHECKBOX_CHECKED);
-      int topOffsetClear = topOffset + (_menuItemFont[menuItemFontSize].height * _textSize - sprite->height) / 2 + _textSize;
-      _agfx.fillRect(menuValuesLeftOffset, topOffsetClear, sprite->width, sprite->height, backColor);
-      drawSprite(menuValuesLeftOffset, topOffset, GEM_ICON_CHECKBOX_CHECKED, foreColor, menuItemTmp);
-    } else {
-      GEMSprite* sprite = getSprite(GEM_ICON_CHECKBOX_UNCHECKED);
-      int topOffsetClear = topOffset + (_menuItemFont[menuItemFontSize].height * _textSize - sprite->height) / 2 + _textSize;
-      _agfx.fillRect(menuValuesLeftOffset, topOffsetClear, sprite->width, sprite->height, backColor);
-      drawSprite(menuValuesLeftOffset, topOffset, GEM_ICON_CHECKBOX_UNCHECKED, foreColor, menuItemTmp);
-    }
-    _editValueMode = false;
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToNextScreen() {
+  _controller->goToNextScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::clearValueVisibleRange() {
-  int pointerPosition = getCurrentItemTopOffset();
-  byte cursorLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-  _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _agfx.width() - cursorLeftOffset - 1, getCurrentAppearance()->menuItemHeight + 1, _menuBackgroundColor);
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToPrevInteractiveMenuItem() {
+  _controller->goToPrevInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::initEditValueCursor() {
-  _editValueCursorPosition = 0;
-  _editValueVirtualCursorPosition = 0;
-  if (_editValueType == GEM_VAL_SELECT || _editValueType == GEM_VAL_SPINNER) {
-    drawEditValueSelect();
-  } else {
-    char chr = _valueString[_editValueVirtualCursorPosition];
-    drawEditValueDigit(chr);
-  }
+GEM_adafruit_gfx& GEM_adafruit_gfx::goToNextInteractiveMenuItem() {
+  _controller->goToNextInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_adafruit_gfx::nextEditValueCursorPosition() {
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  drawEditValueDigit(chr, true);
-  byte menuItemValueLength = getMenuItemValueLength();
-  if ((_editValueCursorPosition != menuItemValueLength - 1) && (_editValueCursorPosition != _editValueLength - 1) && (_valueString[_editValueCursorPosition] != '\0')) {
-    _editValueCursorPosition++;
-  }
-  if ((_editValueVirtualCursorPosition != _editValueLength - 1) && (_valueString[_editValueVirtualCursorPosition] != '\0')) {
-    _editValueVirtualCursorPosition++;
-    if (_editValueCursorPosition == menuItemValueLength - 1) {
-      clearValueVisibleRange();
-      printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
-    }
-  }
-  chr = _valueString[_editValueVirtualCursorPosition];
-  drawEditValueDigit(chr);
+//====================== VALUE EDIT
+
+void GEM_adafruit_gfx::drawCheckbox() {
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
+  int topOffset = getCurrentItemTopOffset(true);
+  byte menuPointerType = _layout.appearance->menuPointerType;
+  uint16_t foreColor = (menuPointerType == GEM_POINTER_DASH) ? _menuForegroundColor : _menuBackgroundColor;
+  uint16_t backColor = (menuPointerType == GEM_POINTER_DASH) ? _menuBackgroundColor : _menuForegroundColor;
+  byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  byte spriteId = *(bool*)menuItemTmp->linkedVariable ? GEM_ICON_CHECKBOX_CHECKED : GEM_ICON_CHECKBOX_UNCHECKED;
+  GEMSprite* sprite = getSprite(spriteId);
+  int topOffsetClear = topOffset + (_menuItemFont[getMenuItemFontSize()].height * _textSize - sprite->height) / 2 + _textSize;
+  _agfx.fillRect(menuValuesLeftOffset, topOffsetClear, sprite->width, sprite->height, backColor);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+  drawSprite(menuValuesLeftOffset, topOffset, spriteId, foreColor, menuItemTmp);
 }
 
-void GEM_adafruit_gfx::prevEditValueCursorPosition() {
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  drawEditValueDigit(chr, true);
-  if (_editValueCursorPosition != 0) {
-    _editValueCursorPosition--;
-  }
-  if (_editValueVirtualCursorPosition != 0) {
-    _editValueVirtualCursorPosition--;
-    if (_editValueCursorPosition == 0) {
-      clearValueVisibleRange();
-      printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition);
-    }
-  }
-  chr = _valueString[_editValueVirtualCursorPosition];
-  drawEditValueDigit(chr);
+void GEM_adafruit_gfx::clearValueVisibleRange() {
+  int pointerPosition = getCurrentItemTopOffset();
+  byte cursorLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _agfx.width() - cursorLeftOffset - 1, _layout.appearance->menuItemHeight + 1, _menuBackgroundColor);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
 }
 
 void GEM_adafruit_gfx::drawEditValueCursor(bool clear) {
   int pointerPosition = getCurrentItemTopOffset();
   byte menuItemFontSize = getMenuItemFontSize();
-  byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
-  byte cursorLeftOffset = menuValuesLeftOffset + _editValueCursorPosition * _menuItemFont[menuItemFontSize].width * _textSize;
-  if (_editValueType == GEM_VAL_SELECT || _editValueType == GEM_VAL_SPINNER) {
-    _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _agfx.width() - cursorLeftOffset - 1, getCurrentAppearance()->menuItemHeight + 1, clear ? _menuBackgroundColor : _menuForegroundColor);
+  byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
+  byte cursorLeftOffset = menuValuesLeftOffset + _view.editValueCursorPosition * _menuItemFont[menuItemFontSize].width * _textSize;
+  if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+    _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _agfx.width() - cursorLeftOffset - 1, _layout.appearance->menuItemHeight + 1, clear ? _menuBackgroundColor : _menuForegroundColor);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
   } else {
-    _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _menuItemFont[menuItemFontSize].width * _textSize + 1, getCurrentAppearance()->menuItemHeight + 1, clear ? _menuBackgroundColor : _menuForegroundColor);
+    _agfx.fillRect(cursorLeftOffset - 1, pointerPosition - 1, _menuItemFont[menuItemFontSize].width * _textSize + 1, _layout.appearance->menuItemHeight + 1, clear ? _menuBackgroundColor : _menuForegroundColor);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
     byte yText = pointerPosition + getMenuItemInsetOffset() + _menuItemFont[menuItemFontSize].baselineOffset * _textSize;
     _agfx.setCursor(menuValuesLeftOffset, yText);
   }
 }
 
-void GEM_adafruit_gfx::nextEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_ACCENT:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_BANG;
-          break;
-        default:
-          code++;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        default:
-          code++;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_9:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_0;
-        break;
-      default:
-        code++;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
-}
-
-void GEM_adafruit_gfx::prevEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        case GEM_CHAR_CODE_BANG:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_a:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        default:
-          code--;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        default:
-          code--;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_0:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      default:
-        code--;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
-}
-
-#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-void GEM_adafruit_gfx::callPreviewCallback(bool reset) {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp->previewCallbackAction != nullptr) {
-    GEMPreviewCallbackData previewCallbackData;
-    previewCallbackData.callbackData = menuItemTmp->callbackData;
-    if (!reset) {
-      previewCallbackData.type = menuItemTmp->linkedType;
-      switch (menuItemTmp->linkedType) {
-        case GEM_VAL_INTEGER:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValInt = atoi(_valueString);
-          break;
-        case GEM_VAL_BYTE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValByte = atoi(_valueString);
-          break;
-        case GEM_VAL_CHAR:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValChar = _valueString;
-          break;
-        case GEM_VAL_SELECT:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSelect* select = menuItemTmp->select;
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            select->setValue(&previewCallbackData.previewValByte, _valueSelectNum);
-            previewCallbackData.type = select->getType();
-          }
-          break;
-        #ifdef GEM_SUPPORT_SPINNER
-        case GEM_VAL_SPINNER:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSpinner* spinner = menuItemTmp->spinner;
-            void* linkedVariable = menuItemTmp->getLinkedVariablePointer();
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            spinner->setValue(&previewCallbackData.previewValByte, _valueSelectNum, linkedVariable);
-            previewCallbackData.type = spinner->getType();
-          }
-          break;
-        #endif
-        #ifdef GEM_SUPPORT_FLOAT_EDIT
-        case GEM_VAL_FLOAT:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValFloat = atof(_valueString);
-          break;
-        case GEM_VAL_DOUBLE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValDouble = atof(_valueString);
-          break;
-        #endif
-      }
-    }
-    menuItemTmp->previewCallbackAction(previewCallbackData);
+void GEM_adafruit_gfx::moveEditValueCursor(byte dirty) {
+  printEditValueDigit(true);
+  byte offsetPrev = _view.editValueVirtualCursorPosition - _view.editValueCursorPosition;
+  _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+  byte offset = _view.editValueVirtualCursorPosition - _view.editValueCursorPosition;
+  if (offset != offsetPrev || dirty == (GEM_DIRTY_VALUE | GEM_DIRTY_CURSOR)) {
+    // Visible part of the value is scrolled (or changed digit is no longer under the cursor)
+    clearValueVisibleRange();
+    _agfx.setCursor(_layout.appearance->menuValuesLeftOffset, getCurrentItemTopOffset(true) + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize);
+    printMenuItemValue(_controller->valueString, 0, offset);
   }
+  printEditValueDigit();
 }
-#endif
 
-void GEM_adafruit_gfx::drawEditValueDigit(byte code, bool clear) {
+void GEM_adafruit_gfx::printEditValueDigit(bool clear) {
   drawEditValueCursor(clear);
   uint16_t foreColor = (clear) ? _menuForegroundColor : _menuBackgroundColor;
   uint16_t backColor = (clear) ? _menuBackgroundColor : _menuForegroundColor;
   int pointerPosition = getCurrentItemTopOffset();
   byte menuItemFontSize = getMenuItemFontSize();
-  byte xText = getCurrentAppearance()->menuValuesLeftOffset + _editValueCursorPosition * _menuItemFont[menuItemFontSize].width * _textSize;
+  byte xText = _layout.appearance->menuValuesLeftOffset + _view.editValueCursorPosition * _menuItemFont[menuItemFontSize].width * _textSize;
   byte yText = pointerPosition + getMenuItemInsetOffset() + _menuItemFont[menuItemFontSize].baselineOffset * _textSize;
-  char chrNew = (char)code;
-  if (chrNew != '\0') {
-    _valueString[_editValueVirtualCursorPosition] = chrNew;
-    _agfx.drawChar(xText, yText, code, foreColor, backColor, _textSize);
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-}
-
-void GEM_adafruit_gfx::nextEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum+1 < select->getLength()) {
-    _valueSelectNum++;
-  } else if (select->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-
-void GEM_adafruit_gfx::prevEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (select->getLoop()) {
-    _valueSelectNum = select->getLength() - 1;
+  char chr = _controller->valueString[_view.editValueVirtualCursorPosition];
+  if (chr != '\0') {
+    _agfx.drawChar(xText, yText, chr, foreColor, backColor, _textSize);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
   }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-
-#ifdef GEM_SUPPORT_SPINNER
-void GEM_adafruit_gfx::nextEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum+1 < spinner->getLength()) {
-    _valueSelectNum++;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
 }
 
-void GEM_adafruit_gfx::prevEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = spinner->getLength() - 1;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawEditValueSelect();
-}
-#endif
-
 void GEM_adafruit_gfx::drawEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
   drawEditValueCursor();
   _agfx.setTextColor(_menuBackgroundColor);
   
   int pointerPosition = getCurrentItemTopOffset();
   byte yText = pointerPosition + getMenuItemInsetOffset() + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize;
-  _agfx.setCursor(getCurrentAppearance()->menuValuesLeftOffset, yText);
+  _agfx.setCursor(_layout.appearance->menuValuesLeftOffset, yText);
   byte spriteId = GEM_ICON_SELECT_ARROWS;
   
   switch (menuItemTmp->linkedType) {
     case GEM_VAL_SELECT:
       {
         GEMSelect* select = menuItemTmp->select;
-        printMenuItemValue(select->getOptionNameByIndex(_valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+        printMenuItemValue(select->getOptionNameByIndex(_controller->valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
       }
       break;
     #ifdef GEM_SUPPORT_SPINNER
@@ -1090,7 +1008,7 @@ void GEM_adafruit_gfx::drawEditValueSelect() {
       {
         char valueStringTmp[GEM_STR_LEN];
         GEMSpinner* spinner = menuItemTmp->spinner;
-        GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _valueSelectNum);
+        GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _controller->valueSelectNum);
         switch (spinner->getType()) {
           case GEM_VAL_BYTE:
             itoa(valueTmp.valByte, valueStringTmp, 10);
@@ -1098,12 +1016,15 @@ void GEM_adafruit_gfx::drawEditValueSelect() {
           case GEM_VAL_INTEGER:
             itoa(valueTmp.valInt, valueStringTmp, 10);
             break;
+          case GEM_VAL_FIXED:
+            GEMFormat::formatFixed(valueTmp.valFixed, ((GEMFixed*)menuItemTmp->linkedVariable)->precision, valueStringTmp);
+            break;
           #ifdef GEM_SUPPORT_FLOAT_EDIT
           case GEM_VAL_FLOAT:
-            dtostrf(valueTmp.valFloat, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+            GEMFormat::formatFloat(valueTmp.valFloat, menuItemTmp->precision, valueStringTmp);
             break;
           case GEM_VAL_DOUBLE:
-            dtostrf(valueTmp.valDouble, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+            GEMFormat::formatFloat(valueTmp.valDouble, menuItemTmp->precision, valueStringTmp);
             break;
           #endif
         }
@@ -1118,104 +1039,136 @@ void GEM_adafruit_gfx::drawEditValueSelect() {
   _agfx.setTextColor(_menuForegroundColor);
 }
 
-void GEM_adafruit_gfx::saveEditValue() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  switch (menuItemTmp->linkedType) {
-    case GEM_VAL_INTEGER:
-      *(int*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_BYTE:
-      *(byte*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_CHAR:
-      strcpy((char*)menuItemTmp->linkedVariable, trimString(_valueString)); // Potential overflow if string length is not defined
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        select->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        spinner->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      *(float*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    case GEM_VAL_DOUBLE:
-      *(double*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    #endif
+void GEM_adafruit_gfx::drawEditValue() {
+  if (_layout.appearance->menuPointerType != GEM_POINTER_DASH) {
+    drawMenuPointer(true); // Row of the current menu item is not highlighted in edit mode
   }
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    if (!_editValueMode) { // Edge case e.g. when edit mode was activated from inside callback (e.g. on another menu item)
-      drawMenu();
-    }
+  if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+    drawEditValueSelect();
   } else {
-    // exitEditValue(false); // Can speed up work of Adafruit GFX version of GEM on UNO R3, but disabled to be in line with other GEM versions
-    exitEditValue();
+    clearValueVisibleRange();
+    _agfx.setCursor(_layout.appearance->menuValuesLeftOffset, getCurrentItemTopOffset(true) + _menuItemFont[getMenuItemFontSize()].baselineOffset * _textSize);
+    printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
+    printEditValueDigit();
   }
 }
 
-void GEM_adafruit_gfx::cancelEditValue() {
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback(true);
-  #endif
-  exitEditValue(false);
+bool GEM_adafruit_gfx::isEditMode() {
+  return _controller->editValueMode;
 }
 
-void GEM_adafruit_gfx::resetEditValueState() {
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
-  _editValueMode = false;
+#ifdef GEM_ENABLE_ADVANCED_MODE
+
+void GEM_adafruit_gfx::nextMenuItem() {
+  _controller->nextMenuItem();
+  flushPendingDraw();
 }
 
-void GEM_adafruit_gfx::exitEditValue(bool redrawMenu) {
-  resetEditValueState();
-  if (redrawMenu) {
-    drawMenu();
-  } else {
-    drawMenuPointer(getCurrentAppearance()->menuPointerType == GEM_POINTER_DASH);
-  }
+void GEM_adafruit_gfx::prevMenuItem() {
+  _controller->prevMenuItem();
+  flushPendingDraw();
 }
 
-bool GEM_adafruit_gfx::isEditMode() {
-  return _editValueMode;
+void GEM_adafruit_gfx::menuItemSelect() {
+  _controller->menuItemSelect();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::enterEditValueMode() {
+  _controller->enterEditValueMode();
+  flushPendingDraw();
 }
 
-// Trim leading/trailing whitespaces
-// Author: Adam Rosenfield, https://stackoverflow.com/a/122721
-char* GEM_adafruit_gfx::trimString(char* str) {
-  char *end;
+void GEM_adafruit_gfx::checkboxToggle() {
+  _controller->checkboxToggle();
+  flushPendingDraw();
+}
 
-  // Trim leading space
-  while(isspace((unsigned char)*str)) str++;
+void GEM_adafruit_gfx::initEditValueCursor() {
+  // Edit cursor on screen follows the one of the controller
+  _controller->editValueVirtualCursorPosition = 0;
+  _controller->markDirty(GEM_DIRTY_CURSOR);
+  flushPendingDraw();
+}
 
-  if(*str == 0)  // All spaces?
-    return str;
+void GEM_adafruit_gfx::nextEditValueCursorPosition() {
+  _controller->nextEditValueCursorPosition();
+  flushPendingDraw();
+}
 
-  // Trim trailing space
-  end = str + strlen(str) - 1;
-  while(end > str && isspace((unsigned char)*end)) end--;
+void GEM_adafruit_gfx::prevEditValueCursorPosition() {
+  _controller->prevEditValueCursorPosition();
+  flushPendingDraw();
+}
 
-  // Write new null terminator
-  *(end+1) = 0;
-  
-  return str;
+void GEM_adafruit_gfx::nextEditValueDigit() {
+  _controller->nextEditValueDigit();
+  flushPendingDraw();
 }
 
+void GEM_adafruit_gfx::prevEditValueDigit() {
+  _controller->prevEditValueDigit();
+  flushPendingDraw();
+}
+
+#ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
+void GEM_adafruit_gfx::callPreviewCallback(bool reset) {
+  _controller->callPreviewCallback(reset);
+  flushPendingDraw();
+}
+
+#endif
+
+void GEM_adafruit_gfx::drawEditValueDigit(byte code) {
+  _controller->setEditValueDigit(code);
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::nextEditValueSelect() {
+  _controller->nextEditValueSelect();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::prevEditValueSelect() {
+  _controller->prevEditValueSelect();
+  flushPendingDraw();
+}
+
+#ifdef GEM_SUPPORT_SPINNER
+void GEM_adafruit_gfx::nextEditValueSpinner() {
+  _controller->nextEditValueSpinner();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::prevEditValueSpinner() {
+  _controller->prevEditValueSpinner();
+  flushPendingDraw();
+}
+
+#endif
+
+void GEM_adafruit_gfx::saveEditValue() {
+  _controller->saveEditValue();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::cancelEditValue() {
+  _controller->cancelEditValue();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::resetEditValueState() {
+  _controller->resetEditValueState();
+  flushPendingDraw();
+}
+
+void GEM_adafruit_gfx::exitEditValue() {
+  _controller->exitEditValue();
+  flushPendingDraw();
+}
+
+#endif
+
 //====================== KEY DETECTION
 
 bool GEM_adafruit_gfx::readyForKey() {
@@ -1230,11 +1183,67 @@ bool GEM_adafruit_gfx::readyForKey() {
 }
 
 GEM_adafruit_gfx& GEM_adafruit_gfx::registerKeyPress(byte keyCode) {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Splash screen displayed by GEM_adafruit_gfx::initAsync() is dismissed by the first key press (the key press is not registered otherwise)
+    if (keyCode != GEM_KEY_NONE) {
+      dismissSplash();
+    } else {
+      poll();
+    }
+    return *this;
+  }
   _currentKey = keyCode;
+  if (_deferredDrawing && context.loop == nullptr) {
+    if (keyCode == GEM_KEY_UP || keyCode == GEM_KEY_DOWN || keyCode == GEM_KEY_PAGE_UP || keyCode == GEM_KEY_PAGE_DOWN || keyCode == GEM_KEY_HOME || keyCode == GEM_KEY_END) {
+      // Navigation and value changes only mark the screen for redraw, it is drawn later by GEM_adafruit_gfx::drawPending()
+      _controller->dispatchKeyPress(keyCode, getMenuItemsPerScreen());
+      return *this;
+    } else if (keyCode != GEM_KEY_NONE) {
+      // Screen should be up to date before any other action (and callbacks it may trigger) takes place
+      flushPendingDraw();
+    }
+  }
+  #ifdef GEM_ENABLE_PROFILING
+  // Everything drawn in response to the key press is recorded as a single frame
+  if (keyCode != GEM_KEY_NONE) {
+    GEM_PROFILE_FRAME_BEGIN();
+    dispatchKeyPress();
+    GEM_PROFILE_FRAME_END();
+    return *this;
+  }
+  #endif
   dispatchKeyPress();
   return *this;
 }
 
+#ifdef GEM_ENABLE_KEY_QUEUE
+bool GEM_adafruit_gfx::enqueueKey(byte keyCode) {
+  return _keyQueue.push(keyCode);
+}
+
+GEM_adafruit_gfx& GEM_adafruit_gfx::processKeys() {
+  if (!readyForKey()) {
+    // Context loop handles key presses by itself
+    _keyQueue.clear();
+    return *this;
+  }
+  byte keyCode;
+  if (!_keyQueue.pop(keyCode)) {
+    // Context loop (if any) is called even if there is no key press, same as with registerKeyPress(GEM_KEY_NONE)
+    keyCode = GEM_KEY_NONE;
+  }
+  do {
+    registerKeyPress(keyCode);
+  } while ((context.loop == nullptr || context.allowExit) && _keyQueue.pop(keyCode));
+  drawPending();
+  return *this;
+}
+
+GEMKeyQueue& GEM_adafruit_gfx::getKeyQueue() {
+  return _keyQueue;
+}
+#endif
+
 void GEM_adafruit_gfx::dispatchKeyPress() {
 
   if (context.loop != nullptr) {
@@ -1250,97 +1259,10 @@ void GEM_adafruit_gfx::dispatchKeyPress() {
       context.loop();
     }
   } else {
-  
-    if (_editValueMode) {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          if (_editValueType == GEM_VAL_SELECT) {
-            prevEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              prevEditValueSpinner();
-            } else {
-              nextEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            prevEditValueDigit();
-          } else {
-            nextEditValueDigit();
-          }
-          break;
-        case GEM_KEY_RIGHT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            nextEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          if (_editValueType == GEM_VAL_SELECT) {
-            nextEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              nextEditValueSpinner();
-            } else {
-              prevEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            nextEditValueDigit();
-          } else {
-            prevEditValueDigit();
-          }
-          break;
-        case GEM_KEY_LEFT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            prevEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          cancelEditValue();
-          break;
-        case GEM_KEY_OK:
-          saveEditValue();
-          break;
-      }
-    } else {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          prevMenuItem();
-          break;
-        case GEM_KEY_RIGHT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr && (
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_LINK ||
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BUTTON)) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          nextMenuItem();
-          break;
-        case GEM_KEY_LEFT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr &&
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BACK) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          if (_menuPageCurrent->getMenuItem(0) != nullptr &&
-              _menuPageCurrent->getMenuItem(0)->type == GEM_ITEM_BACK) {
-            _menuPageCurrent->currentItemNum = 0;
-            menuItemSelect();
-          } else if (_menuPageCurrent->exitAction != nullptr) {
-            _menuPageCurrent->currentItemNum = 0;
-            _menuPageCurrent->exitAction();
-          }
-          break;
-        case GEM_KEY_OK:
-          menuItemSelect();
-          break;
-      }
+    _controller->dispatchKeyPress(_currentKey, getMenuItemsPerScreen());
+    if (_currentKey != GEM_KEY_NONE) {
+      flushPendingDraw();
     }
-
   }
 }
 
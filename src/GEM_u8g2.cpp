@@ -39,33 +39,6 @@
 
 #include "sprites/sprites-u8g2-default.h"
 
-// AVR-based Arduinos have suppoort for dtostrf, some others may require manual inclusion (e.g. SAMD),
-// see https://github.com/plotly/arduino-api/issues/38#issuecomment-108987647
-#if defined(GEM_SUPPORT_FLOAT_EDIT) && (defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52840))
-#include <avr/dtostrf.h>
-#endif
-
-// Macro constants (aliases) for some of the ASCII character codes
-#define GEM_CHAR_CODE_9 57
-#define GEM_CHAR_CODE_0 48
-#define GEM_CHAR_CODE_MINUS 45
-#define GEM_CHAR_CODE_DOT 46
-#define GEM_CHAR_CODE_SPACE 32
-#define GEM_CHAR_CODE_UNDERSCORE 95
-#define GEM_CHAR_CODE_TILDA 126
-#define GEM_CHAR_CODE_BANG 33
-#define GEM_CHAR_CODE_a 97
-#define GEM_CHAR_CODE_ACCENT 96
-/*
-// WIP for Cyrillic values support
-#define GEM_CHAR_CODE_CYR_YO 1025
-#define GEM_CHAR_CODE_CYR_A 1040
-#define GEM_CHAR_CODE_CYR_E 1045
-#define GEM_CHAR_CODE_CYR_E_SM 1077
-#define GEM_CHAR_CODE_CYR_YA_SM 1103
-#define GEM_CHAR_CODE_CYR_YO_SM 1105
-*/
-
 // XBM image of the default GEM _splash screen (GEM logo v1)
 /*
 #define logo_width  12
@@ -96,12 +69,10 @@ GEM_u8g2::GEM_u8g2(U8G2& u8g2_, byte menuPointerType_, byte menuItemsPerScreen_,
   _appearance.menuValuesLeftOffset = menuValuesLeftOffset_;
   _appearance.sprites = sprites_;
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo;
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->attachView(_view);
 }
 
 GEM_u8g2::GEM_u8g2(U8G2& u8g2_, GEMAppearance appearance_)
@@ -109,39 +80,50 @@ GEM_u8g2::GEM_u8g2(U8G2& u8g2_, GEMAppearance appearance_)
   , _appearance(appearance_)
 {
   _appearanceCurrent = &_appearance;
+  updateLayout();
   _splash = logo;
   clearContext();
-  _editValueMode = false;
-  _editValueCursorPosition = 0;
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
+  _controller->attachView(_view);
 }
 
 //====================== APPEARANCE OPERATIONS
 
 GEM_u8g2& GEM_u8g2::setAppearance(GEMAppearance appearance) {
   _appearance = appearance;
+  updateLayout();
+  _drawnMenuPage = nullptr;
   return *this;
 }
 
 GEMAppearance* GEM_u8g2::getCurrentAppearance() {
-  return (_menuPageCurrent != nullptr && _menuPageCurrent->_appearance != nullptr) ? _menuPageCurrent->_appearance : &_appearance;
+  return (_controller->menuPageCurrent != nullptr && _controller->menuPageCurrent->_appearance != nullptr) ? _controller->menuPageCurrent->_appearance : &_appearance;
+}
+
+void GEM_u8g2::updateLayout() {
+  GEMAppearance* appearance = getCurrentAppearance();
+  byte menuItemFontSize = appearance->menuItemHeight >= _menuItemFont[0].height ? 0 : 1;
+  _layout.appearance = appearance;
+  _layout.menuItemsPerScreen = appearance->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_u8g2.getDisplayHeight() - appearance->menuPageScreenTopOffset) / appearance->menuItemHeight : appearance->menuItemsPerScreen;
+  _layout.menuItemFontSize = menuItemFontSize;
+  _layout.menuItemTitleLength = (appearance->menuValuesLeftOffset - 5) / _menuItemFont[menuItemFontSize].width;
+  _layout.menuItemValueLength = (_u8g2.getDisplayWidth() - appearance->menuValuesLeftOffset - 6) / _menuItemFont[menuItemFontSize].width;
+  _layout.menuItemInsetOffset = (appearance->menuItemHeight - _menuItemFont[menuItemFontSize].height) / 2 - 1;
 }
 
 byte GEM_u8g2::getMenuItemsPerScreen() {
-  return getCurrentAppearance()->menuItemsPerScreen == GEM_ITEMS_COUNT_AUTO ? (_u8g2.getDisplayHeight() - getCurrentAppearance()->menuPageScreenTopOffset) / getCurrentAppearance()->menuItemHeight : getCurrentAppearance()->menuItemsPerScreen;
+  return _layout.menuItemsPerScreen;
 }
 
 byte GEM_u8g2::getMenuItemFontSize() {
-  return getCurrentAppearance()->menuItemHeight >= _menuItemFont[0].height ? 0 : 1;
+  return _layout.menuItemFontSize;
 }
 
 byte GEM_u8g2::getMenuItemTitleLength() {
-  return (getCurrentAppearance()->menuValuesLeftOffset - 5) / _menuItemFont[getMenuItemFontSize()].width;
+  return _layout.menuItemTitleLength;
 }
 
 byte GEM_u8g2::getMenuItemValueLength() {
-  return (_u8g2.getDisplayWidth() - getCurrentAppearance()->menuValuesLeftOffset - 6) / _menuItemFont[getMenuItemFontSize()].width;
+  return _layout.menuItemValueLength;
 }
 
 //====================== INIT OPERATIONS
@@ -185,82 +167,154 @@ GEM_u8g2& GEM_u8g2::enableCyrillic(bool flag) {
   }
   _menuItemFont[0] = {6, 8};
   _menuItemFont[1] = {4, 6};
+  updateLayout();
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::setFontBig(const uint8_t* font, uint8_t width, uint8_t height) {
   _fontFamilies.big = font;
   _menuItemFont[0] = {width, height};
+  updateLayout();
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::setFontBig() {
   _fontFamilies.big = _UTF8Enabled ? GEM_FONT_BIG_CYR : GEM_FONT_BIG;
   _menuItemFont[0] = {6, 8};
+  updateLayout();
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::setFontSmall(const uint8_t* font, uint8_t width, uint8_t height) {
   _fontFamilies.small = font;
   _menuItemFont[1] = {width, height};
+  updateLayout();
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::setFontSmall() {
   _fontFamilies.small = _UTF8Enabled ? GEM_FONT_SMALL_CYR : GEM_FONT_SMALL;
   _menuItemFont[1] = {4, 6};
+  updateLayout();
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::invertKeysDuringEdit(bool invert) {
-  _invertKeysDuringEdit = invert;
+  _controller->_invertKeysDuringEdit = invert;
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::setCharAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_charAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::setDigitAcceleration(uint16_t interval, byte pressesPerStage, byte factor, byte maxStage) {
+  _controller->_digitAcceleration = {interval, pressesPerStage, factor, maxStage};
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::enablePartialUpdate(bool flag) {
+  _partialUpdate = flag;
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::enableDeferredDrawing(bool flag) {
+  _deferredDrawing = flag;
+  if (!_deferredDrawing) {
+    flushPendingDraw();
+  }
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::setMaxFrameRate(byte fps) {
+  _maxFrameRate = fps;
   return *this;
 }
 
 GEM_u8g2& GEM_u8g2::init() {
+  initAsync();
+  if (_splashState != GEM_SPLASH_NONE) {
+    if (_enableVersion) {
+      delay(_splashDelay / 2);
+      drawSplashVersion();
+      delay(_splashDelay / 2);
+    } else {
+      delay(_splashDelay);
+    }
+    finishSplash();
+  }
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::initAsync() {
+  updateLayout();
   _u8g2.clear();
+  _drawnMenuPage = nullptr;
   _u8g2.setDrawColor(1);
   _u8g2.setFontPosTop();
 
+  _splashState = GEM_SPLASH_NONE;
   if (_splashDelay > 0) {
-
     _u8g2.firstPage();
     do {
       _u8g2.drawXBMP((_u8g2.getDisplayWidth() - _splash.width) / 2, (_u8g2.getDisplayHeight() - _splash.height) / 2, _splash.width, _splash.height, _splash.image);
     } while (_u8g2.nextPage());
+    _splashState = GEM_SPLASH_LOGO;
+    _splashStart = millis();
+  }
 
-    if (_enableVersion) {
-      delay(_splashDelay / 2);
-      _u8g2.firstPage();
-      do {
-        _u8g2.drawXBMP((_u8g2.getDisplayWidth() - _splash.width) / 2, (_u8g2.getDisplayHeight() - _splash.height) / 2, _splash.width, _splash.height, _splash.image);
-        _u8g2.setFont(_fontFamilies.small);
-        byte x = _u8g2.getDisplayWidth() - strlen(GEM_VER)*4;
-        byte y = _u8g2.getDisplayHeight() - 7;
-        if (_splash.image != logo_bits) {
-          _u8g2.setCursor(x - 12, y);
-          _u8g2.print("GEM");
-        } else {
-          _u8g2.setCursor(x, y);
-        }
-        _u8g2.print(GEM_VER);
-      } while (_u8g2.nextPage());
-      delay(_splashDelay / 2);
-    } else {
-      delay(_splashDelay);
-    }
+  return *this;
+}
 
-    _u8g2.clear();
+bool GEM_u8g2::poll() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    unsigned long elapsed = millis() - _splashStart;
+    if (elapsed >= _splashDelay) {
+      dismissSplash();
+    } else if (_splashState == GEM_SPLASH_LOGO && _enableVersion && elapsed >= _splashDelay / 2) {
+      drawSplashVersion();
+      _splashState = GEM_SPLASH_VERSION;
+    }
+  }
+  return _splashState != GEM_SPLASH_NONE;
+}
 
+void GEM_u8g2::dismissSplash() {
+  finishSplash();
+  if (_controller->menuPageCurrent != nullptr) {
+    drawMenu();
   }
+}
 
-  return *this;
+void GEM_u8g2::drawSplashVersion() {
+  _u8g2.firstPage();
+  do {
+    _u8g2.drawXBMP((_u8g2.getDisplayWidth() - _splash.width) / 2, (_u8g2.getDisplayHeight() - _splash.height) / 2, _splash.width, _splash.height, _splash.image);
+    _u8g2.setFont(_fontFamilies.small);
+    byte x = _u8g2.getDisplayWidth() - strlen(GEM_VER)*4;
+    byte y = _u8g2.getDisplayHeight() - 7;
+    if (_splash.image != logo_bits) {
+      _u8g2.setCursor(x - 12, y);
+      _u8g2.print("GEM");
+    } else {
+      _u8g2.setCursor(x, y);
+    }
+    _u8g2.print(GEM_VER);
+  } while (_u8g2.nextPage());
+}
+
+void GEM_u8g2::finishSplash() {
+  _splashState = GEM_SPLASH_NONE;
+  _u8g2.clear();
 }
 
 GEM_u8g2& GEM_u8g2::reInit() {
+  updateLayout();
   _u8g2.initDisplay();
   _u8g2.setPowerSave(0);
   _u8g2.clear();
+  _drawnMenuPage = nullptr;
   _u8g2.setDrawColor(1);
   _u8g2.setFontPosTop();
   if (_UTF8Enabled) {
@@ -272,12 +326,26 @@ GEM_u8g2& GEM_u8g2::reInit() {
 }
 
 GEM_u8g2& GEM_u8g2::setMenuPageCurrent(GEMPage& menuPageCurrent) {
-  _menuPageCurrent = &menuPageCurrent;
+  _controller->setMenuPageCurrent(menuPageCurrent);
+  updateLayout();
   return *this;
 }
 
 GEMPage* GEM_u8g2::getCurrentMenuPage() {
-  return _menuPageCurrent;
+  return _controller->menuPageCurrent;
+}
+
+GEM_u8g2& GEM_u8g2::setController(GEMController& controller) {
+  _controller->detachView(_view);
+  _controller = &controller;
+  _view = GEMView(); // Nothing pending for the previous controller (changed parts, dirty range, position of the edit cursor) applies to the new one
+  _controller->attachView(_view);
+  _view.dirty = GEM_DIRTY_MENU;
+  return *this;
+}
+
+GEMController& GEM_u8g2::getController() {
+  return *_controller;
 }
 
 //====================== CONTEXT OPERATIONS
@@ -293,20 +361,213 @@ GEM_u8g2& GEM_u8g2::clearContext() {
 //====================== DRAW OPERATIONS
 
 GEM_u8g2& GEM_u8g2::drawMenu() {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Menu is drawn once splash screen is dismissed
+    return *this;
+  }
+  updateLayout();
+  if (_controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+  }
+  GEM_PROFILE_FRAME_BEGIN();
+  _view.dirty = 0; // Everything is drawn anew
   // _u8g2.clear(); // Not clearing for better performance
   _u8g2.firstPage();
   do {
-    drawTitleBar();
-    printMenuItems();
-    drawMenuPointer();
-    drawScrollbar();
-    if (drawMenuCallback != nullptr) {
-      drawMenuCallback();
-    }
+    drawMenuContents();
   } while (_u8g2.nextPage());
+  _drawnMenuPage = _controller->menuPageCurrent;
+  _drawnItemNum = _controller->menuPageCurrent->currentItemNum;
+  GEM_PROFILE_FRAME_END();
+  return *this;
+}
+
+GEM_u8g2& GEM_u8g2::drawPending() {
+  if (_view.dirty != 0 && (_maxFrameRate == 0 || millis() - _lastFrameTime >= 1000 / _maxFrameRate)) {
+    flushPendingDraw();
+  }
   return *this;
 }
 
+#ifdef GEM_ENABLE_REFRESH
+GEM_u8g2& GEM_u8g2::refresh() {
+  if (_controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    return *this;
+  }
+  flushPendingDraw();
+  // Without partial update each repaint is a full frame, so at most one is drawn
+  bool fullRedraw = !_partialUpdate || _drawnMenuPage != _controller->menuPageCurrent || _u8g2.getBufferTileHeight() * 8 < _u8g2.getDisplayHeight();
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  byte menuItemHeight = _layout.appearance->menuItemHeight;
+  GEMItem* menuItemCurrent = _controller->menuPageCurrent->getCurrentMenuItem();
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(_controller->menuPageCurrent->currentItemNum / menuItemsPerScreen * menuItemsPerScreen);
+  int y = _layout.appearance->menuPageScreenTopOffset;
+  int top = -1;
+  int bottom = -1;
+  for (byte i = 0; menuItemTmp != nullptr && i < menuItemsPerScreen; i++) {
+    if (menuItemTmp->type == GEM_ITEM_VAL && !(_controller->editValueMode && menuItemTmp == menuItemCurrent) && _drawnValues.changed(menuItemTmp, menuItemTmp->getValueHash())) {
+      if (fullRedraw) {
+        drawMenu();
+        return *this;
+      }
+      if (top >= 0 && (y - 1) / 8 > bottom / 8 + 1) {
+        // Tile rows of the changed values are not adjacent, transfer the preceding ones separately
+        updateMenuArea(top, bottom, _layout.appearance->menuValuesLeftOffset - 1);
+        top = -1;
+      }
+      if (top < 0) {
+        top = y - 1;
+      }
+      bottom = y + menuItemHeight - 1;
+    }
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    y += menuItemHeight;
+  }
+  if (top >= 0) {
+    updateMenuArea(top, bottom, _layout.appearance->menuValuesLeftOffset - 1);
+  }
+  return *this;
+}
+#endif
+
+void GEM_u8g2::flushPendingDraw() {
+  byte dirty = _view.dirty & ~GEM_DIRTY_ITEMS; // Changed menu items are drawn separately (see updateMenuItems())
+  if (_view.dirty == 0 || _controller->menuPageCurrent == nullptr || _splashState != GEM_SPLASH_NONE || context.loop != nullptr) {
+    // Nothing changed since the last frame (or menu is not displayed)
+    return;
+  }
+  #ifdef GEM_ENABLE_REFRESH
+  if (dirty & (GEM_DIRTY_EDIT | GEM_DIRTY_VALUE)) {
+    _drawnValues.invalidate(_controller->menuPageCurrent->getCurrentMenuItem()); // Value is drawn by edit mode (or toggled in place), so it is repainted by the next refresh()
+  }
+  #endif
+  GEM_PROFILE_FRAME_BEGIN();
+  GEMIndex currentItemNum = _controller->menuPageCurrent->currentItemNum;
+  if (_controller->editValueMode) {
+    _view.updateEditValueCursor(_controller->editValueVirtualCursorPosition, getMenuItemValueLength());
+  }
+  if ((dirty & GEM_DIRTY_MENU) || _drawnMenuPage != _controller->menuPageCurrent || ((dirty & GEM_DIRTY_POINTER) && dirty != GEM_DIRTY_POINTER)) {
+    drawMenu();
+  } else if (dirty == GEM_DIRTY_POINTER) {
+    if (_drawnItemNum != currentItemNum) {
+      updateMenuPointer(_drawnItemNum);
+    }
+  } else if (dirty != 0) {
+    // Edit mode was entered or exited, or value being edited changed
+    updateCurrentMenuItem();
+  }
+  if (_view.dirty & GEM_DIRTY_ITEMS) {
+    updateMenuItems(); // Menu items changed and were not drawn along with the whole menu
+  }
+  _view.dirty = 0;
+  _drawnItemNum = currentItemNum;
+  GEM_PROFILE_FRAME_END();
+  _lastFrameTime = millis();
+}
+
+void GEM_u8g2::drawMenuContents() {
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_TITLE);
+  drawTitleBar();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_ITEMS);
+  printMenuItems();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_POINTER);
+  drawMenuPointer();
+  GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_SCROLLBAR);
+  drawScrollbar();
+  GEM_PROFILE_PHASE_END();
+  if (drawMenuCallback != nullptr) {
+    GEM_PROFILE_PHASE_BEGIN(GEM_PROFILE_CALLBACK);
+    drawMenuCallback();
+    GEM_PROFILE_PHASE_END();
+  }
+}
+
+void GEM_u8g2::updateMenuArea(int top, int bottom, int left) {
+  // Partial update is only possible when the whole screen is kept in buffer, and the buffer holds the current menu page
+  byte bufferTileHeight = _u8g2.getBufferTileHeight();
+  if (!_partialUpdate || _drawnMenuPage != _controller->menuPageCurrent || bufferTileHeight * 8 < _u8g2.getDisplayHeight()) {
+    drawMenu();
+    return;
+  }
+  GEM_PROFILE_FRAME_BEGIN();
+  byte tileTop = top > 0 ? top / 8 : 0;
+  byte tileBottom = bottom / 8 < bufferTileHeight ? bottom / 8 : bufferTileHeight - 1;
+  byte tileLeft = left > 0 ? left / 8 : 0;
+  u8g2_uint_t yTop = tileTop * 8;
+  u8g2_uint_t yBottom = (tileBottom + 1) * 8;
+  u8g2_uint_t xLeft = tileLeft * 8;
+  _u8g2.setClipWindow(xLeft, yTop, _u8g2.getDisplayWidth(), yBottom);
+  _u8g2.setDrawColor(0);
+  _u8g2.drawBox(xLeft, yTop, _u8g2.getDisplayWidth() - xLeft, yBottom - yTop);
+  GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
+  _u8g2.setDrawColor(1);
+  #ifdef GEM_ENABLE_REFRESH
+  _clipTop = yTop;
+  _clipBottom = yBottom;
+  _clipLeft = xLeft;
+  #endif
+  drawMenuContents(); // Everything outside of the clip window is discarded by U8g2
+  #ifdef GEM_ENABLE_REFRESH
+  _clipTop = 0;
+  _clipBottom = 0x7FFF;
+  _clipLeft = 0;
+  #endif
+  _u8g2.setMaxClipWindow();
+  _u8g2.updateDisplayArea(tileLeft, tileTop, _u8g2.getBufferTileWidth() - tileLeft, tileBottom - tileTop + 1);
+  GEM_PROFILE_FRAME_END();
+}
+
+void GEM_u8g2::updateCurrentMenuItem() {
+  int top = getCurrentItemTopOffset() - 1;
+  updateMenuArea(top, top + _layout.appearance->menuItemHeight);
+}
+
+void GEM_u8g2::updateMenuItems() {
+  if (_view.dirtyItemLast == GEM_LAST_POS) {
+    // Number of menu items (hence the scrollbar) may have changed as well
+    drawMenu();
+    return;
+  }
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  byte menuItemHeight = _layout.appearance->menuItemHeight;
+  GEMIndex screenFirstItemNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen * menuItemsPerScreen;
+  int y = _layout.appearance->menuPageScreenTopOffset;
+  int top = -1;
+  int bottom = -1;
+  for (byte i = 0; i < menuItemsPerScreen; i++) {
+    if (_view.areMenuItemsDirty(screenFirstItemNum + i, 1)) {
+      if (top < 0) {
+        top = y - 1;
+      }
+      bottom = y + menuItemHeight - 1;
+    }
+    y += menuItemHeight;
+  }
+  if (top >= 0) {
+    updateMenuArea(top, bottom); // Rows between the changed ones are transferred as well
+  }
+}
+
+void GEM_u8g2::updateMenuPointer(GEMIndex menuItemNumPrev) {
+  byte menuItemsPerScreen = getMenuItemsPerScreen();
+  byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
+  if (menuItemNumPrev / menuItemsPerScreen != _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen) {
+    updateMenuArea(menuPageScreenTopOffset - 1, _u8g2.getDisplayHeight() - 1);
+  } else {
+    byte menuItemHeight = _layout.appearance->menuItemHeight;
+    byte row = _controller->menuPageCurrent->currentItemNum % menuItemsPerScreen;
+    byte rowPrev = menuItemNumPrev % menuItemsPerScreen;
+    int topFirst = (row < rowPrev ? row : rowPrev) * menuItemHeight + menuPageScreenTopOffset - 1;
+    int topLast = (row < rowPrev ? rowPrev : row) * menuItemHeight + menuPageScreenTopOffset - 1;
+    if (topLast / 8 <= (topFirst + menuItemHeight) / 8 + 1) {
+      updateMenuArea(topFirst, topLast + menuItemHeight); // Tile rows of both menu items are adjacent (or shared), transfer them at once
+    } else {
+      updateMenuArea(topFirst, topFirst + menuItemHeight);
+      updateMenuArea(topLast, topLast + menuItemHeight);
+    }
+  }
+}
+
 GEM_u8g2& GEM_u8g2::setDrawMenuCallback(void (*drawMenuCallback_)()) {
   drawMenuCallback = drawMenuCallback_;
   return *this;
@@ -320,7 +581,12 @@ GEM_u8g2& GEM_u8g2::removeDrawMenuCallback() {
 void GEM_u8g2::drawTitleBar() {
  _u8g2.setFont(_fontFamilies.small);
  _u8g2.setCursor(5, 0);
- _u8g2.print(_menuPageCurrent->title);
+ if (_controller->menuPageCurrent->titleProgmem) {
+   _u8g2.print(reinterpret_cast<const __FlashStringHelper*>(_controller->menuPageCurrent->title));
+ } else {
+   _u8g2.print(_controller->menuPageCurrent->title);
+ }
+ GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, GEMFormat::length(_controller->menuPageCurrent->title, _controller->menuPageCurrent->titleProgmem));
  _u8g2.setFont(getMenuItemFontSize() ? _fontFamilies.small : _fontFamilies.big);
 }
 
@@ -328,7 +594,7 @@ GEMSprite* GEM_u8g2::getSprite(byte spriteId) {
   GEMSprite* sprite = nullptr;
   byte len = sizeof(spritesDefault_u8g2)/sizeof(spritesDefault_u8g2[0]);
   if (spriteId < len) {
-    void* pSprites = getCurrentAppearance()->sprites == nullptr ? spritesDefault_u8g2 : getCurrentAppearance()->sprites;
+    void* pSprites = _layout.appearance->sprites == nullptr ? spritesDefault_u8g2 : _layout.appearance->sprites;
     GEMSprite* (*pSpritesCast)[len] = static_cast<GEMSprite* (*)[len]>(pSprites);
     sprite = (*pSpritesCast)[spriteId];
   }
@@ -346,6 +612,7 @@ void GEM_u8g2::drawSprite(u8g2_uint_t x, u8g2_uint_t y, byte spriteId, GEMItem*
       byte menuItemFontSize = getMenuItemFontSize();
       int offset = withInsetOffset ? 1 + (_menuItemFont[menuItemFontSize].height - sprite->height) / 2 : 0; // With additional offset for centered vertical alignment with text
       _u8g2.drawXBMP(x, y + offset, sprite->width, sprite->height, sprite->image);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_BITMAP, 1);
     }
   }
 }
@@ -360,60 +627,83 @@ GEM_u8g2& GEM_u8g2::removeDrawSpriteCallback() {
   return *this;
 }
 
-void GEM_u8g2::printMenuItemString(const char* str, byte num, byte startPos) {
+#ifdef GEM_ENABLE_PROFILING
+GEMProfiler& GEM_u8g2::getProfiler() {
+  return _profiler;
+}
+#endif
+
+void GEM_u8g2::printMenuItemString(const char* str, byte num, byte startPos, bool progmem) {
   if (_UTF8Enabled) {
 
     byte j = 0;
     byte p = 0;
-    while ((j < startPos || ((byte)str[p] >= 128 && (byte)str[p] <= 191)) && str[p] != '\0') {
-      if ((byte)str[p] <= 127 || (byte)str[p] >= 194) {
+    byte c = GEMFormat::readChar(str, p, progmem);
+    while ((j < startPos || (c >= 128 && c <= 191)) && c != '\0') {
+      if (c <= 127 || c >= 194) {
         j++;
       }
       p++;
+      c = GEMFormat::readChar(str, p, progmem);
     }
     byte startPosReal = p;
 
     byte i = j;
     byte k = startPosReal;
-    while ((i < num + j || ((byte)str[k] >= 128 && (byte)str[k] <= 191)) && str[k] != '\0') {
-      _u8g2.print(str[k]);
-      if ((byte)str[k] <= 127 || (byte)str[k] >= 194) {
+    c = GEMFormat::readChar(str, k, progmem);
+    while ((i < num + j || (c >= 128 && c <= 191)) && c != '\0') {
+      _u8g2.print((char)c);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
+      if (c <= 127 || c >= 194) {
         i++;
       }
       k++;
+      c = GEMFormat::readChar(str, k, progmem);
     }
 
   } else {
 
     byte i = startPos;
-    while (i < num + startPos && str[i] != '\0') {
-      _u8g2.print(str[i]);
+    char c;
+    while (i < num + startPos && (c = GEMFormat::readChar(str, i, progmem)) != '\0') {
+      _u8g2.print(c);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
       i++;
     }
 
   }
 }
 
-void GEM_u8g2::printMenuItemTitle(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + offset);
+void GEM_u8g2::printMenuItemTitle(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + offset, 0, progmem);
+}
+
+void GEM_u8g2::printMenuItemValue(const char* str, int offset, byte startPos, bool progmem) {
+  printMenuItemString(str, getMenuItemValueLength() + offset, startPos, progmem);
 }
 
-void GEM_u8g2::printMenuItemValue(const char* str, int offset, byte startPos) {
-  printMenuItemString(str, getMenuItemValueLength() + offset, startPos);
+char* GEM_u8g2::formatMenuItemValue(GEMItem* menuItemTmp, byte linkedType, char* valueStringTmp) {
+  char* valueString = valueStringTmp;
+  #ifdef GEM_ENABLE_VALUE_CACHE
+  byte precision = (linkedType == GEM_VAL_FIXED) ? ((GEMFixed*)menuItemTmp->linkedVariable)->precision : menuItemTmp->precision;
+  if (_valueCache.lookup(menuItemTmp, linkedType, precision, menuItemTmp->linkedVariable, valueString)) {
+    // Value hasn't changed since it was formatted the last time
+    return valueString;
+  }
+  #endif
+  return GEMFormat::formatValue(menuItemTmp->linkedVariable, linkedType, menuItemTmp->precision, valueString);
 }
 
-void GEM_u8g2::printMenuItemFull(const char* str, int offset) {
-  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset);
+void GEM_u8g2::printMenuItemFull(const char* str, int offset, bool progmem) {
+  printMenuItemString(str, getMenuItemTitleLength() + getMenuItemValueLength() + offset, 0, progmem);
 }
 
 byte GEM_u8g2::getMenuItemInsetOffset() {
-  byte menuItemFontSize = getMenuItemFontSize();
-  byte menuItemInsetOffset = (getCurrentAppearance()->menuItemHeight - _menuItemFont[menuItemFontSize].height) / 2 - 1;
-  return menuItemInsetOffset;
+  return _layout.menuItemInsetOffset;
 }
 
 byte GEM_u8g2::getCurrentItemTopOffset(bool withInsetOffset) {
-  return (_menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * getCurrentAppearance()->menuItemHeight + getCurrentAppearance()->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
+  return (_controller->menuPageCurrent->currentItemNum % getMenuItemsPerScreen()) * _layout.appearance->menuItemHeight + _layout.appearance->menuPageScreenTopOffset + (withInsetOffset ? getMenuItemInsetOffset() : 0);
 }
 
 byte GEM_u8g2::calculateSpriteOverlap(byte spriteId) {
@@ -422,9 +712,10 @@ byte GEM_u8g2::calculateSpriteOverlap(byte spriteId) {
 
 void GEM_u8g2::printMenuItems() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte currentPageScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-  GEMItem* menuItemTmp = _menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
-  byte y = getCurrentAppearance()->menuPageScreenTopOffset;
+  GEMIndex currentPageScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+  GEMItem* menuItemTmp = _controller->menuPageCurrent->getMenuItem(currentPageScreenNum * menuItemsPerScreen);
+  GEMItem* menuItemEdited = _controller->editValueMode ? _controller->menuPageCurrent->getCurrentMenuItem() : nullptr; // Looked up once, before menu items of the screen are stepped through
+  byte y = _layout.appearance->menuPageScreenTopOffset;
   byte i = 0;
   char valueStringTmp[GEM_STR_LEN];
   while (menuItemTmp != nullptr && i < menuItemsPerScreen) {
@@ -434,37 +725,36 @@ void GEM_u8g2::printMenuItems() {
       case GEM_ITEM_VAL:
         {
           _u8g2.setCursor(5, yText);
-          if (menuItemTmp->readonly) {
-            printMenuItemTitle(menuItemTmp->title, -1);
+          if (menuItemTmp->flags.readonly) {
+            printMenuItemTitle(menuItemTmp->title, -1, menuItemTmp->flags.titleProgmem);
             _u8g2.print("^");
+            GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
           } else {
-            printMenuItemTitle(menuItemTmp->title);
+            printMenuItemTitle(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
           }
 
-          byte menuValuesLeftOffset = getCurrentAppearance()->menuValuesLeftOffset;
+          byte menuValuesLeftOffset = _layout.appearance->menuValuesLeftOffset;
           _u8g2.setCursor(menuValuesLeftOffset, yText);
           switch (menuItemTmp->linkedType) {
             case GEM_VAL_INTEGER:
-              if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
                 drawEditValueCursor();
               } else {
-                itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                printMenuItemValue(valueStringTmp);
+                printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_INTEGER, valueStringTmp));
               }
               break;
             case GEM_VAL_BYTE:
-              if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
                 drawEditValueCursor();
               } else {
-                itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                printMenuItemValue(valueStringTmp);
+                printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_BYTE, valueStringTmp));
               }
               break;
             case GEM_VAL_CHAR:
-              if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
                 drawEditValueCursor();
               } else {
                 printMenuItemValue((char*)menuItemTmp->linkedVariable);
@@ -480,12 +770,12 @@ void GEM_u8g2::printMenuItems() {
             case GEM_VAL_SELECT:
               {
                 GEMSelect* select = menuItemTmp->select;
-                if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                  printMenuItemValue(select->getOptionNameByIndex(_valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+                if (menuItemTmp == menuItemEdited) {
+                  printMenuItemValue(select->getOptionNameByIndex(_controller->valueSelectNum), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
                   drawSprite(_u8g2.getDisplayWidth() - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, menuItemTmp);
                   drawEditValueCursor();
                 } else {
-                  printMenuItemValue(select->getSelectedOptionName(menuItemTmp->linkedVariable), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS));
+                  printMenuItemValue(select->getOptionNameByIndex(menuItemTmp->getSelectedOptionNum()), -1 * calculateSpriteOverlap(GEM_ICON_SELECT_ARROWS), 0, select->getProgmem());
                   drawSprite(_u8g2.getDisplayWidth() - getSprite(GEM_ICON_SELECT_ARROWS)->width - 1, yDraw, GEM_ICON_SELECT_ARROWS, menuItemTmp);
                 }
               }
@@ -494,8 +784,8 @@ void GEM_u8g2::printMenuItems() {
             case GEM_VAL_SPINNER:
               {
                 GEMSpinner* spinner = menuItemTmp->spinner;
-                if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                  GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _valueSelectNum);
+                if (menuItemTmp == menuItemEdited) {
+                  GEMSpinnerValue valueTmp = spinner->getOptionNameByIndex(menuItemTmp->linkedVariable, _controller->valueSelectNum);
                   switch (spinner->getType()) {
                     case GEM_VAL_BYTE:
                       itoa(valueTmp.valByte, valueStringTmp, 10);
@@ -503,12 +793,15 @@ void GEM_u8g2::printMenuItems() {
                     case GEM_VAL_INTEGER:
                       itoa(valueTmp.valInt, valueStringTmp, 10);
                       break;
+                    case GEM_VAL_FIXED:
+                      GEMFormat::formatFixed(valueTmp.valFixed, ((GEMFixed*)menuItemTmp->linkedVariable)->precision, valueStringTmp);
+                      break;
                     #ifdef GEM_SUPPORT_FLOAT_EDIT
                     case GEM_VAL_FLOAT:
-                      dtostrf(valueTmp.valFloat, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+                      GEMFormat::formatFloat(valueTmp.valFloat, menuItemTmp->precision, valueStringTmp);
                       break;
                     case GEM_VAL_DOUBLE:
-                      dtostrf(valueTmp.valDouble, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
+                      GEMFormat::formatFloat(valueTmp.valDouble, menuItemTmp->precision, valueStringTmp);
                       break;
                     #endif
                   }
@@ -516,60 +809,55 @@ void GEM_u8g2::printMenuItems() {
                   drawSprite(_u8g2.getDisplayWidth() - getSprite(GEM_ICON_SPINNER_ARROWS)->width - 1, yDraw, GEM_ICON_SPINNER_ARROWS, menuItemTmp);
                   drawEditValueCursor();
                 } else {
-                  switch (spinner->getType()) {
-                    case GEM_VAL_BYTE:
-                      itoa(*(byte*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                      break;
-                    case GEM_VAL_INTEGER:
-                      itoa(*(int*)menuItemTmp->linkedVariable, valueStringTmp, 10);
-                      break;
-                    #ifdef GEM_SUPPORT_FLOAT_EDIT
-                    case GEM_VAL_FLOAT:
-                      dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                      break;
-                    case GEM_VAL_DOUBLE:
-                      dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                      break;
-                    #endif
-                  }
-                  printMenuItemValue(valueStringTmp, -1 * calculateSpriteOverlap(GEM_ICON_SPINNER_ARROWS));
+                  printMenuItemValue(formatMenuItemValue(menuItemTmp, spinner->getType(), valueStringTmp), -1 * calculateSpriteOverlap(GEM_ICON_SPINNER_ARROWS));
                   drawSprite(_u8g2.getDisplayWidth() - getSprite(GEM_ICON_SPINNER_ARROWS)->width - 1, yDraw, GEM_ICON_SPINNER_ARROWS, menuItemTmp);
                 }
               }
               break;
             #endif
+            case GEM_VAL_FIXED:
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
+                drawEditValueCursor();
+              } else {
+                printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FIXED, valueStringTmp));
+              }
+              break;
             #ifdef GEM_SUPPORT_FLOAT_EDIT
             case GEM_VAL_FLOAT:
-              if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
                 drawEditValueCursor();
               } else {
-                // sprintf(valueStringTmp,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-                dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                printMenuItemValue(valueStringTmp);
+                printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_FLOAT, valueStringTmp));
               }
               break;
             case GEM_VAL_DOUBLE:
-              if (_editValueMode && menuItemTmp == _menuPageCurrent->getCurrentMenuItem()) {
-                printMenuItemValue(_valueString, 0, _editValueVirtualCursorPosition - _editValueCursorPosition);
+              if (menuItemTmp == menuItemEdited) {
+                printMenuItemValue(_controller->valueString, 0, _view.editValueVirtualCursorPosition - _view.editValueCursorPosition);
                 drawEditValueCursor();
               } else {
-                // sprintf(valueStringTmp,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-                dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, valueStringTmp);
-                printMenuItemValue(valueStringTmp);
+                printMenuItemValue(formatMenuItemValue(menuItemTmp, GEM_VAL_DOUBLE, valueStringTmp));
               }
               break;
             #endif
           }
+          #ifdef GEM_ENABLE_REFRESH
+          // Value is remembered only if it actually reaches the display (i.e. it is not edited and lies within the clip window of the partial update)
+          if (!(menuItemTmp == menuItemEdited) && y >= _clipTop && y + _layout.appearance->menuItemHeight - 1 <= _clipBottom && _clipLeft < menuValuesLeftOffset) {
+            _drawnValues.store(menuItemTmp, menuItemTmp->getValueHash());
+          }
+          #endif
           break;
         }
       case GEM_ITEM_LINK:
         _u8g2.setCursor(5, yText);
-        if (menuItemTmp->readonly) {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT) - 1, menuItemTmp->flags.titleProgmem);
           _u8g2.print("^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT));
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_RIGHT), menuItemTmp->flags.titleProgmem);
         }
         drawSprite(_u8g2.getDisplayWidth() - getSprite(GEM_ICON_ARROW_RIGHT)->width - 2, yDraw, GEM_ICON_ARROW_RIGHT, menuItemTmp);
         break;
@@ -578,49 +866,56 @@ void GEM_u8g2::printMenuItems() {
         break;
       case GEM_ITEM_BUTTON:
         _u8g2.setCursor(5 + getSprite(GEM_ICON_ARROW_BTN)->width, yText);
-        if (menuItemTmp->readonly) {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1);
+        if (menuItemTmp->flags.readonly) {
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN) - 1, menuItemTmp->flags.titleProgmem);
           _u8g2.print("^");
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_CHAR, 1);
         } else {
-          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN));
+          printMenuItemFull(menuItemTmp->title, -1 * calculateSpriteOverlap(GEM_ICON_ARROW_BTN), menuItemTmp->flags.titleProgmem);
         }
         drawSprite(5, yDraw, GEM_ICON_ARROW_BTN, menuItemTmp);
         break;
       case GEM_ITEM_LABEL:
         _u8g2.setCursor(5, yText);
-        printMenuItemFull(menuItemTmp->title);
+        printMenuItemFull(menuItemTmp->title, 0, menuItemTmp->flags.titleProgmem);
         break;
     }
-    menuItemTmp = menuItemTmp->getMenuItemNext();
-    y += getCurrentAppearance()->menuItemHeight;
+    menuItemTmp = _controller->menuPageCurrent->getMenuItemNext(*menuItemTmp);
+    y += _layout.appearance->menuItemHeight;
     i++;
   }
   memset(valueStringTmp, '\0', GEM_STR_LEN - 1);
 }
 
 void GEM_u8g2::drawMenuPointer() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
+  if (_controller->menuPageCurrent->itemsCount > 0) {
+    GEMItem* menuItemTmp = _controller->menuPageCurrent->getCurrentMenuItem();
     int pointerPosition = getCurrentItemTopOffset();
-    byte menuItemHeight = getCurrentAppearance()->menuItemHeight;
-    if (getCurrentAppearance()->menuPointerType == GEM_POINTER_DASH) {
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+    byte menuItemHeight = _layout.appearance->menuItemHeight;
+    if (_layout.appearance->menuPointerType == GEM_POINTER_DASH) {
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         for (byte i = 0; i < (menuItemHeight - 1) / 2; i++) {
           _u8g2.drawPixel(0, pointerPosition + i * 2);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _u8g2.drawPixel(1, pointerPosition + i * 2 + 1);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
         }
       } else {
         _u8g2.drawBox(0, pointerPosition, 2, menuItemHeight - 1);
+        GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       }
-    } else if (!_editValueMode) {
+    } else if (!_controller->editValueMode) {
       _u8g2.setDrawColor(2);
       _u8g2.drawBox(0, pointerPosition - 1, _u8g2.getDisplayWidth() - 2, menuItemHeight + 1);
+      GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
       _u8g2.setDrawColor(1);
-      if (menuItemTmp->readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
+      if (menuItemTmp->flags.readonly || menuItemTmp->type == GEM_ITEM_LABEL) {
         _u8g2.setDrawColor(0);
         for (byte i = 0; i < (menuItemHeight + 2) / 2; i++) {
           _u8g2.drawPixel(0, pointerPosition + i * 2);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
           _u8g2.drawPixel(1, pointerPosition + i * 2 - 1);
+          GEM_PROFILE_COUNT(GEM_PRIMITIVE_PIXEL, 1);
         }
         _u8g2.setDrawColor(1);
       }
@@ -630,575 +925,201 @@ void GEM_u8g2::drawMenuPointer() {
 
 void GEM_u8g2::drawScrollbar() {
   byte menuItemsPerScreen = getMenuItemsPerScreen();
-  byte screensCount = (_menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _menuPageCurrent->itemsCount / menuItemsPerScreen : _menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
+  GEMIndex screensCount = (_controller->menuPageCurrent->itemsCount % menuItemsPerScreen == 0) ? _controller->menuPageCurrent->itemsCount / menuItemsPerScreen : _controller->menuPageCurrent->itemsCount / menuItemsPerScreen + 1;
   if (screensCount > 1) {
-    byte currentScreenNum = _menuPageCurrent->currentItemNum / menuItemsPerScreen;
-    byte menuPageScreenTopOffset = getCurrentAppearance()->menuPageScreenTopOffset;
-    byte scrollbarHeight = (_u8g2.getDisplayHeight() - menuPageScreenTopOffset + 1) / screensCount;
-    byte scrollbarPosition = currentScreenNum * scrollbarHeight + menuPageScreenTopOffset - 1;
+    GEMIndex currentScreenNum = _controller->menuPageCurrent->currentItemNum / menuItemsPerScreen;
+    byte menuPageScreenTopOffset = _layout.appearance->menuPageScreenTopOffset;
+    int scrollbarSpace = _u8g2.getDisplayHeight() - menuPageScreenTopOffset + 1;
+    // When there are more screens than pixels available, scrollbar is kept 1px high and its position is scaled instead
+    byte scrollbarHeight = (screensCount <= scrollbarSpace) ? scrollbarSpace / screensCount : 1;
+    int scrollbarPosition = ((screensCount <= scrollbarSpace) ? currentScreenNum * scrollbarHeight : (long)currentScreenNum * (scrollbarSpace - 1) / (screensCount - 1)) + menuPageScreenTopOffset - 1;
     _u8g2.drawLine(_u8g2.getDisplayWidth() - 1, scrollbarPosition, _u8g2.getDisplayWidth() - 1, scrollbarPosition + scrollbarHeight);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_LINE, 1);
   }
 }
 
 //====================== MENU ITEMS NAVIGATION
 
-void GEM_u8g2::nextMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (_menuPageCurrent->currentItemNum == _menuPageCurrent->itemsCount-1) {
-      _menuPageCurrent->currentItemNum = 0;
-    } else {
-      _menuPageCurrent->currentItemNum++;
-    }
-    drawMenu();
-  }
+GEM_u8g2& GEM_u8g2::goToMenuItem(GEMIndex index) {
+  _controller->goToMenuItem(index);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::prevMenuItem() {
-  if (_menuPageCurrent->itemsCount > 0) {
-    if (_menuPageCurrent->currentItemNum == 0) {
-      _menuPageCurrent->currentItemNum = _menuPageCurrent->itemsCount-1;
-    } else {
-      _menuPageCurrent->currentItemNum--;
-    }
-    drawMenu();
-  }
+GEM_u8g2& GEM_u8g2::goToMenuItem(GEMItem& menuItem) {
+  _controller->goToMenuItem(menuItem);
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::menuItemSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp != nullptr) {
-    switch (menuItemTmp->type) {
-      case GEM_ITEM_VAL:
-        if (!menuItemTmp->readonly) {
-          enterEditValueMode();
-        }
-        break;
-      case GEM_ITEM_LINK:
-        if (!menuItemTmp->readonly) {
-          _menuPageCurrent = menuItemTmp->linkedPage;
-          drawMenu();
-        }
-        break;
-      case GEM_ITEM_BACK:
-        _menuPageCurrent->currentItemNum = (_menuPageCurrent->itemsCount > 1) ? 1 : 0;
-        _menuPageCurrent = menuItemTmp->linkedPage;
-        drawMenu();
-        break;
-      case GEM_ITEM_BUTTON:
-        if (!menuItemTmp->readonly) {
-          if (menuItemTmp->callbackWithArgs) {
-            menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-          } else {
-            menuItemTmp->callbackAction();
-          }
-        }
-        break;
-    }
-  }
+GEM_u8g2& GEM_u8g2::goToFirstMenuItem() {
+  _controller->goToFirstMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-//====================== VALUE EDIT
-
-void GEM_u8g2::enterEditValueMode() {
-  _editValueMode = true;
-  
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  _editValueType = menuItemTmp->linkedType;
-  switch (_editValueType) {
-    case GEM_VAL_INTEGER:
-      itoa(*(int*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 6;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BYTE:
-      itoa(*(byte*)menuItemTmp->linkedVariable, _valueString, 10);
-      _editValueLength = 3;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_CHAR:
-      strcpy(_valueString, (char*)menuItemTmp->linkedVariable);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_BOOL:
-      checkboxToggle();
-      drawMenu();
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        _valueSelectNum = select->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        _valueSelectNum = spinner->getSelectedOptionNum(menuItemTmp->linkedVariable);
-        initEditValueCursor();
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      // sprintf(_valueString,"%.6f", *(float*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(float*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    case GEM_VAL_DOUBLE:
-      // sprintf(_valueString,"%.6f", *(double*)menuItemTmp->linkedVariable); // May work for non-AVR boards
-      dtostrf(*(double*)menuItemTmp->linkedVariable, menuItemTmp->precision + 1, menuItemTmp->precision, _valueString);
-      _editValueLength = GEM_STR_LEN - 1;
-      initEditValueCursor();
-      break;
-    #endif
-  }
+GEM_u8g2& GEM_u8g2::goToLastMenuItem() {
+  _controller->goToLastMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::checkboxToggle() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  bool checkboxValue = *(bool*)menuItemTmp->linkedVariable;
-  *(bool*)menuItemTmp->linkedVariable = !checkboxValue;
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    drawEditValueCursor();
-    drawMenu();
-  } else {
-    _editValueMode = false;
-  }
+GEM_u8g2& GEM_u8g2::goToPrevScreen() {
+  _controller->goToPrevScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::initEditValueCursor() {
-  _editValueCursorPosition = 0;
-  _editValueVirtualCursorPosition = 0;
-  drawMenu();
+GEM_u8g2& GEM_u8g2::goToNextScreen() {
+  _controller->goToNextScreen(getMenuItemsPerScreen());
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::nextEditValueCursorPosition() {
-  if ((_editValueCursorPosition != getMenuItemValueLength() - 1) && (_editValueCursorPosition != _editValueLength - 1) && (_valueString[_editValueCursorPosition] != '\0')) {
-    _editValueCursorPosition++;
-  }
-  if ((_editValueVirtualCursorPosition != _editValueLength - 1) && (_valueString[_editValueVirtualCursorPosition] != '\0')) {
-    _editValueVirtualCursorPosition++;
-  }
-  drawMenu();
+GEM_u8g2& GEM_u8g2::goToPrevInteractiveMenuItem() {
+  _controller->goToPrevInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
-void GEM_u8g2::prevEditValueCursorPosition() {
-  if (_editValueCursorPosition != 0) {
-    _editValueCursorPosition--;
-  }
-  if (_editValueVirtualCursorPosition != 0) {
-    _editValueVirtualCursorPosition--;
-  }
-  drawMenu();
+GEM_u8g2& GEM_u8g2::goToNextInteractiveMenuItem() {
+  _controller->goToNextInteractiveMenuItem();
+  flushPendingDraw();
+  return *this;
 }
 
+//====================== VALUE EDIT
+
 void GEM_u8g2::drawEditValueCursor() {
   int pointerPosition = getCurrentItemTopOffset();
   byte menuItemFontSize = getMenuItemFontSize();
-  byte cursorLeftOffset = getCurrentAppearance()->menuValuesLeftOffset + _editValueCursorPosition * _menuItemFont[menuItemFontSize].width;
+  byte cursorLeftOffset = _layout.appearance->menuValuesLeftOffset + _view.editValueCursorPosition * _menuItemFont[menuItemFontSize].width;
   _u8g2.setDrawColor(2);
-  if (_editValueType == GEM_VAL_SELECT || _editValueType == GEM_VAL_SPINNER) {
-    _u8g2.drawBox(cursorLeftOffset - 1, pointerPosition - 1, _u8g2.getDisplayWidth() - cursorLeftOffset - 1, getCurrentAppearance()->menuItemHeight + 1);
+  if (_controller->editValueType == GEM_VAL_SELECT || _controller->editValueType == GEM_VAL_SPINNER) {
+    _u8g2.drawBox(cursorLeftOffset - 1, pointerPosition - 1, _u8g2.getDisplayWidth() - cursorLeftOffset - 1, _layout.appearance->menuItemHeight + 1);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
   } else {
-    _u8g2.drawBox(cursorLeftOffset - 1, pointerPosition - 1, _menuItemFont[menuItemFontSize].width + 1, getCurrentAppearance()->menuItemHeight + 1);
+    _u8g2.drawBox(cursorLeftOffset - 1, pointerPosition - 1, _menuItemFont[menuItemFontSize].width + 1, _layout.appearance->menuItemHeight + 1);
+    GEM_PROFILE_COUNT(GEM_PRIMITIVE_RECT, 1);
   }
   _u8g2.setDrawColor(1);
 }
 
+bool GEM_u8g2::isEditMode() {
+  return _controller->editValueMode;
+}
+
+#ifdef GEM_ENABLE_ADVANCED_MODE
+
+void GEM_u8g2::nextMenuItem() {
+  _controller->nextMenuItem();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::prevMenuItem() {
+  _controller->prevMenuItem();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::menuItemSelect() {
+  _controller->menuItemSelect();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::enterEditValueMode() {
+  _controller->enterEditValueMode();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::checkboxToggle() {
+  _controller->checkboxToggle();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::initEditValueCursor() {
+  // Edit cursor on screen follows the one of the controller
+  _controller->editValueVirtualCursorPosition = 0;
+  _controller->markDirty(GEM_DIRTY_CURSOR);
+  flushPendingDraw();
+}
+
+void GEM_u8g2::nextEditValueCursorPosition() {
+  _controller->nextEditValueCursorPosition();
+  flushPendingDraw();
+}
+
+void GEM_u8g2::prevEditValueCursorPosition() {
+  _controller->prevEditValueCursorPosition();
+  flushPendingDraw();
+}
+
 void GEM_u8g2::nextEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_a;
-          break;
-        case GEM_CHAR_CODE_ACCENT:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_BANG;
-          break;
-        default:
-          code++;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_TILDA:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        /*
-        // WIP for Cyrillic values support
-        case GEM_CHAR_CODE_TILDA:
-          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_A : GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_CYR_YA_SM:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_CYR_E:
-          code = GEM_CHAR_CODE_CYR_YO;
-          break;
-        case GEM_CHAR_CODE_CYR_YO:
-          code = GEM_CHAR_CODE_CYR_E + 1;
-          break;
-        case GEM_CHAR_CODE_CYR_E_SM:
-          code = GEM_CHAR_CODE_CYR_YO_SM;
-          break;
-        case GEM_CHAR_CODE_CYR_YO_SM:
-          code = GEM_CHAR_CODE_CYR_E_SM + 1;
-          break;
-        */
-        default:
-          code++;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_9:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_0;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_0;
-        break;
-      default:
-        code++;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
+  _controller->nextEditValueDigit();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::prevEditValueDigit() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  char chr = _valueString[_editValueVirtualCursorPosition];
-  byte code = (byte)chr;
-  if (_editValueType == GEM_VAL_CHAR) {
-    if (menuItemTmp->adjustedAsciiOrder) {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        case GEM_CHAR_CODE_BANG:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_a:
-          code = GEM_CHAR_CODE_SPACE;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_ACCENT;
-          break;
-        default:
-          code--;
-          break;
-      }
-    } else {
-      switch (code) {
-        case 0:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        /*
-        // WIP for Cyrillic values support
-        case 0:
-          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_YA_SM : GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_SPACE:
-          code = _cyrillicEnabled ? GEM_CHAR_CODE_CYR_YA_SM : GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_CYR_A:
-          code = GEM_CHAR_CODE_TILDA;
-          break;
-        case GEM_CHAR_CODE_CYR_E + 1:
-          code = GEM_CHAR_CODE_CYR_YO;
-          break;
-        case GEM_CHAR_CODE_CYR_YO:
-          code = GEM_CHAR_CODE_CYR_E;
-          break;
-        case GEM_CHAR_CODE_CYR_E_SM + 1:
-          code = GEM_CHAR_CODE_CYR_YO_SM;
-          break;
-        case GEM_CHAR_CODE_CYR_YO_SM:
-          code = GEM_CHAR_CODE_CYR_E_SM;
-          break;
-        */
-        default:
-          code--;
-          break;
-      }
-    }
-  } else {
-    switch (code) {
-      case 0:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_MINUS:
-        code = GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_0:
-        code = (_editValueCursorPosition != 0 && (_editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_DOT : GEM_CHAR_CODE_SPACE;
-        break;
-      case GEM_CHAR_CODE_SPACE:
-        code = (_editValueCursorPosition == 0 && (_editValueType == GEM_VAL_INTEGER || _editValueType == GEM_VAL_FLOAT || _editValueType == GEM_VAL_DOUBLE)) ? GEM_CHAR_CODE_MINUS : GEM_CHAR_CODE_9;
-        break;
-      case GEM_CHAR_CODE_DOT:
-        code = GEM_CHAR_CODE_SPACE;
-        break;
-      default:
-        code--;
-        break;
-    }
-  }
-  drawEditValueDigit(code);
+  _controller->prevEditValueDigit();
+  flushPendingDraw();
 }
 
 #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
 void GEM_u8g2::callPreviewCallback(bool reset) {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  if (menuItemTmp->previewCallbackAction != nullptr) {
-    GEMPreviewCallbackData previewCallbackData;
-    previewCallbackData.callbackData = menuItemTmp->callbackData;
-    if (!reset) {
-      previewCallbackData.type = menuItemTmp->linkedType;
-      switch (menuItemTmp->linkedType) {
-        case GEM_VAL_INTEGER:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValInt = atoi(_valueString);
-          break;
-        case GEM_VAL_BYTE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValByte = atoi(_valueString);
-          break;
-        case GEM_VAL_CHAR:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValChar = _valueString;
-          break;
-        case GEM_VAL_SELECT:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSelect* select = menuItemTmp->select;
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            select->setValue(&previewCallbackData.previewValByte, _valueSelectNum);
-            previewCallbackData.type = select->getType();
-          }
-          break;
-        #ifdef GEM_SUPPORT_SPINNER
-        case GEM_VAL_SPINNER:
-          {
-            previewCallbackData.previewSelectNum = _valueSelectNum;
-            GEMSpinner* spinner = menuItemTmp->spinner;
-            void* linkedVariable = menuItemTmp->getLinkedVariablePointer();
-            // Members of an anonymous union share the same memory location, so we can take pointer to any one of them
-            spinner->setValue(&previewCallbackData.previewValByte, _valueSelectNum, linkedVariable);
-            previewCallbackData.type = spinner->getType();
-          }
-          break;
-        #endif
-        #ifdef GEM_SUPPORT_FLOAT_EDIT
-        case GEM_VAL_FLOAT:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValFloat = atof(_valueString);
-          break;
-        case GEM_VAL_DOUBLE:
-          previewCallbackData.previewString = _valueString;
-          previewCallbackData.previewValDouble = atof(_valueString);
-          break;
-        #endif
-      }
-    }
-    menuItemTmp->previewCallbackAction(previewCallbackData);
-  }
+  _controller->callPreviewCallback(reset);
+  flushPendingDraw();
 }
+
 #endif
 
 void GEM_u8g2::drawEditValueDigit(byte code) {
-  char chrNew = (char)code;
-  _valueString[_editValueVirtualCursorPosition] = chrNew;
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawMenu();
+  _controller->setEditValueDigit(code);
+  flushPendingDraw();
 }
 
 void GEM_u8g2::nextEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum+1 < select->getLength()) {
-    _valueSelectNum++;
-  } else if (select->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawMenu();
+  _controller->nextEditValueSelect();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::prevEditValueSelect() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSelect* select = menuItemTmp->select;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (select->getLoop()) {
-    _valueSelectNum = select->getLength() - 1;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawMenu();
+  _controller->prevEditValueSelect();
+  flushPendingDraw();
 }
 
 #ifdef GEM_SUPPORT_SPINNER
 void GEM_u8g2::nextEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum+1 < spinner->getLength()) {
-    _valueSelectNum++;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = 0;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawMenu();
+  _controller->nextEditValueSpinner();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::prevEditValueSpinner() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  GEMSpinner* spinner = menuItemTmp->spinner;
-  if (_valueSelectNum > 0) {
-    _valueSelectNum--;
-  } else if (spinner->getLoop()) {
-    _valueSelectNum = spinner->getLength() - 1;
-  }
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback();
-  #endif
-  drawMenu();
+  _controller->prevEditValueSpinner();
+  flushPendingDraw();
 }
+
 #endif
 
 void GEM_u8g2::saveEditValue() {
-  GEMItem* menuItemTmp = _menuPageCurrent->getCurrentMenuItem();
-  switch (menuItemTmp->linkedType) {
-    case GEM_VAL_INTEGER:
-      *(int*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_BYTE:
-      *(byte*)menuItemTmp->linkedVariable = atoi(_valueString);
-      break;
-    case GEM_VAL_CHAR:
-      strcpy((char*)menuItemTmp->linkedVariable, trimString(_valueString)); // Potential overflow if string length is not defined
-      break;
-    case GEM_VAL_SELECT:
-      {
-        GEMSelect* select = menuItemTmp->select;
-        select->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #ifdef GEM_SUPPORT_SPINNER
-    case GEM_VAL_SPINNER:
-      {
-        GEMSpinner* spinner = menuItemTmp->spinner;
-        spinner->setValue(menuItemTmp->linkedVariable, _valueSelectNum);
-      }
-      break;
-    #endif
-    #ifdef GEM_SUPPORT_FLOAT_EDIT
-    case GEM_VAL_FLOAT:
-      *(float*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    case GEM_VAL_DOUBLE:
-      *(double*)menuItemTmp->linkedVariable = atof(_valueString);
-      break;
-    #endif
-  }
-  if (menuItemTmp->callbackAction != nullptr) {
-    resetEditValueState(); // Explicitly reset edit value state to be more predictable before user-defined callback is called
-    if (menuItemTmp->callbackWithArgs) {
-      menuItemTmp->callbackActionArg(menuItemTmp->callbackData);
-    } else {
-      menuItemTmp->callbackAction();
-    }
-    drawEditValueCursor();
-    drawMenu();
-  } else {
-    exitEditValue();
-  }
+  _controller->saveEditValue();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::cancelEditValue() {
-  #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-  callPreviewCallback(true);
-  #endif
-  exitEditValue();
+  _controller->cancelEditValue();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::resetEditValueState() {
-  memset(_valueString, '\0', GEM_STR_LEN - 1);
-  _valueSelectNum = -1;
-  _editValueMode = false;
+  _controller->resetEditValueState();
+  flushPendingDraw();
 }
 
 void GEM_u8g2::exitEditValue() {
-  resetEditValueState();
-  drawEditValueCursor();
-  drawMenu();
+  _controller->exitEditValue();
+  flushPendingDraw();
 }
 
-bool GEM_u8g2::isEditMode() {
-  return _editValueMode;
-}
-
-// Trim leading/trailing whitespaces
-// Author: Adam Rosenfield, https://stackoverflow.com/a/122721
-char* GEM_u8g2::trimString(char* str) {
-  char *end;
-
-  // Trim leading space
-  while(isspace((unsigned char)*str)) str++;
-
-  if(*str == 0)  // All spaces?
-    return str;
-
-  // Trim trailing space
-  end = str + strlen(str) - 1;
-  while(end > str && isspace((unsigned char)*end)) end--;
-
-  // Write new null terminator
-  *(end+1) = 0;
-  
-  return str;
-}
+#endif
 
 //====================== KEY DETECTION
 
@@ -1214,11 +1135,95 @@ bool GEM_u8g2::readyForKey() {
 }
 
 GEM_u8g2& GEM_u8g2::registerKeyPress(byte keyCode) {
+  if (_splashState != GEM_SPLASH_NONE) {
+    // Splash screen displayed by GEM_u8g2::initAsync() is dismissed by the first key press (the key press is not registered otherwise)
+    if (keyCode != GEM_KEY_NONE) {
+      dismissSplash();
+    } else {
+      poll();
+    }
+    return *this;
+  }
   _currentKey = keyCode;
+  if (_deferredDrawing && context.loop == nullptr) {
+    if (keyCode == GEM_KEY_UP || keyCode == GEM_KEY_DOWN || keyCode == GEM_KEY_PAGE_UP || keyCode == GEM_KEY_PAGE_DOWN || keyCode == GEM_KEY_HOME || keyCode == GEM_KEY_END) {
+      // Navigation and value changes only mark the area of the screen for update, it is drawn later by GEM_u8g2::drawPending()
+      _controller->dispatchKeyPress(translateKeyCode(keyCode), getMenuItemsPerScreen());
+      return *this;
+    } else if (keyCode != GEM_KEY_NONE) {
+      // Screen should be up to date before any other action (and callbacks it may trigger) takes place
+      flushPendingDraw();
+    }
+  }
+  #ifdef GEM_ENABLE_PROFILING
+  // Everything drawn in response to the key press is recorded as a single frame
+  if (keyCode != GEM_KEY_NONE) {
+    GEM_PROFILE_FRAME_BEGIN();
+    dispatchKeyPress();
+    GEM_PROFILE_FRAME_END();
+    return *this;
+  }
+  #endif
   dispatchKeyPress();
   return *this;
 }
 
+#ifdef GEM_ENABLE_KEY_QUEUE
+bool GEM_u8g2::enqueueKey(byte keyCode) {
+  return _keyQueue.push(keyCode);
+}
+
+GEM_u8g2& GEM_u8g2::processKeys() {
+  if (!readyForKey()) {
+    // Context loop handles key presses by itself
+    _keyQueue.clear();
+    return *this;
+  }
+  byte keyCode;
+  if (!_keyQueue.pop(keyCode)) {
+    // Context loop (if any) is called even if there is no key press, same as with registerKeyPress(GEM_KEY_NONE)
+    keyCode = GEM_KEY_NONE;
+  }
+  do {
+    registerKeyPress(keyCode);
+  } while ((context.loop == nullptr || context.allowExit) && _keyQueue.pop(keyCode));
+  drawPending();
+  return *this;
+}
+
+GEMKeyQueue& GEM_u8g2::getKeyQueue() {
+  return _keyQueue;
+}
+#endif
+
+byte GEM_u8g2::translateKeyCode(byte keyCode) {
+  // Key codes of GEM_u8g2 are mapped to u8g2 constants, hence translated to the ones handled by the controller
+  switch (keyCode) {
+    case GEM_KEY_UP:
+      return GEM_CONTROLLER_KEY_UP;
+    case GEM_KEY_RIGHT:
+      return GEM_CONTROLLER_KEY_RIGHT;
+    case GEM_KEY_DOWN:
+      return GEM_CONTROLLER_KEY_DOWN;
+    case GEM_KEY_LEFT:
+      return GEM_CONTROLLER_KEY_LEFT;
+    case GEM_KEY_CANCEL:
+      return GEM_CONTROLLER_KEY_CANCEL;
+    case GEM_KEY_OK:
+      return GEM_CONTROLLER_KEY_OK;
+    case GEM_KEY_PAGE_UP:
+      return GEM_CONTROLLER_KEY_PAGE_UP;
+    case GEM_KEY_PAGE_DOWN:
+      return GEM_CONTROLLER_KEY_PAGE_DOWN;
+    case GEM_KEY_HOME:
+      return GEM_CONTROLLER_KEY_HOME;
+    case GEM_KEY_END:
+      return GEM_CONTROLLER_KEY_END;
+    default:
+      return GEM_CONTROLLER_KEY_NONE;
+  }
+}
+
 void GEM_u8g2::dispatchKeyPress() {
 
   if (context.loop != nullptr) {
@@ -1234,97 +1239,10 @@ void GEM_u8g2::dispatchKeyPress() {
       context.loop();
     }
   } else {
-  
-    if (_editValueMode) {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          if (_editValueType == GEM_VAL_SELECT) {
-            prevEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              prevEditValueSpinner();
-            } else {
-              nextEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            prevEditValueDigit();
-          } else {
-            nextEditValueDigit();
-          }
-          break;
-        case GEM_KEY_RIGHT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            nextEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          if (_editValueType == GEM_VAL_SELECT) {
-            nextEditValueSelect();
-          #ifdef GEM_SUPPORT_SPINNER
-          } else if (_editValueType == GEM_VAL_SPINNER) {
-            if (_invertKeysDuringEdit) {
-              nextEditValueSpinner();
-            } else {
-              prevEditValueSpinner();
-            }
-          #endif
-          } else if (_invertKeysDuringEdit) {
-            nextEditValueDigit();
-          } else {
-            prevEditValueDigit();
-          }
-          break;
-        case GEM_KEY_LEFT:
-          if (_editValueType != GEM_VAL_SELECT && _editValueType != GEM_VAL_SPINNER) {
-            prevEditValueCursorPosition();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          cancelEditValue();
-          break;
-        case GEM_KEY_OK:
-          saveEditValue();
-          break;
-      }
-    } else {
-      switch (_currentKey) {
-        case GEM_KEY_UP:
-          prevMenuItem();
-          break;
-        case GEM_KEY_RIGHT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr && (
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_LINK ||
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BUTTON)) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_DOWN:
-          nextMenuItem();
-          break;
-        case GEM_KEY_LEFT:
-          if (_menuPageCurrent->getCurrentMenuItem() != nullptr &&
-              _menuPageCurrent->getCurrentMenuItem()->type == GEM_ITEM_BACK) {
-            menuItemSelect();
-          }
-          break;
-        case GEM_KEY_CANCEL:
-          if (_menuPageCurrent->getMenuItem(0) != nullptr &&
-              _menuPageCurrent->getMenuItem(0)->type == GEM_ITEM_BACK) {
-            _menuPageCurrent->currentItemNum = 0;
-            menuItemSelect();
-          } else if (_menuPageCurrent->exitAction != nullptr) {
-            _menuPageCurrent->currentItemNum = 0;
-            _menuPageCurrent->exitAction();
-          }
-          break;
-        case GEM_KEY_OK:
-          menuItemSelect();
-          break;
-      }
+    _controller->dispatchKeyPress(translateKeyCode(_currentKey), getMenuItemsPerScreen());
+    if (_currentKey != GEM_KEY_NONE) {
+      flushPendingDraw();
     }
-
   }
 }
 
@@ -43,11 +43,17 @@
 #include "GEMSprite.h"
 #include "GEMAppearance.h"
 #include "GEMContext.h"
+#include "GEMController.h"
 #include "GEMPage.h"
 #include "GEMSelect.h"
 #ifdef GEM_SUPPORT_SPINNER
 #include "GEMSpinner.h"
 #endif
+#include "GEMProfiler.h"
+#include "GEMValueCache.h"
+#include "GEMDrawnValues.h"
+#include "GEMKeyQueue.h"
+#include "GEMFormat.h"
 #include "constants.h"
 
 // Macro constants (aliases) for u8g2 font families used to draw menu
@@ -64,6 +70,10 @@
 #define GEM_KEY_LEFT    U8X8_MSG_GPIO_MENU_PREV   // Left key is pressed (navigate through the Back button to the previous menu page, select previous digit/char of editable variable)
 #define GEM_KEY_CANCEL  U8X8_MSG_GPIO_MENU_HOME   // Cancel key is pressed (navigate to the previous (parent) menu page, exit edit mode without saving the variable, exit context loop if allowed within context's settings)
 #define GEM_KEY_OK      U8X8_MSG_GPIO_MENU_SELECT // Ok/Apply key is pressed (toggle bool menu item, enter edit mode of the associated non-bool variable, exit edit mode with saving the variable, execute code associated with button)
+#define GEM_KEY_PAGE_UP   241                     // Page Up key is pressed (move menu pointer one screen up)
+#define GEM_KEY_PAGE_DOWN 242                     // Page Down key is pressed (move menu pointer one screen down)
+#define GEM_KEY_HOME      243                     // Home key is pressed (move menu pointer to the first menu item)
+#define GEM_KEY_END       244                     // End key is pressed (move menu pointer to the last menu item)
 
 // Declaration of FontSize type
 struct FontSize {
@@ -125,10 +135,24 @@ class GEM_u8g2 {
     GEM_u8g2& setFontSmall(const uint8_t* font, uint8_t width = 4, uint8_t height = 6); // Set small font
     GEM_u8g2& setFontSmall();                                   // Revert small font to default value (with respect to _UTF8Enabled flag)
     GEM_u8g2& invertKeysDuringEdit(bool invert = true);         // Turn inverted order of characters during edit mode on or off
+    GEM_u8g2& setCharAcceleration(uint16_t interval = 150, byte pressesPerStage = 10, byte factor = 5, byte maxStage = 1); // Accelerate edit of char[17] variables on rapid key presses (by default: 5 characters per key press after 10 key presses),
+                                                                // pass 0 as interval to disable acceleration. Acceleration of spinners is set with GEMSpinner::setAcceleration()
+    GEM_u8g2& setDigitAcceleration(uint16_t interval = 150, byte pressesPerStage = 10, byte factor = 3, byte maxStage = 1); // Accelerate edit of digits of numeric variables on rapid key presses (by default: 3 digits per key press after 10 key presses),
+                                                                // pass 0 as interval to disable acceleration. Accelerated step stops at 9 (or 0) before leaving the range of digits
+    GEM_u8g2& enablePartialUpdate(bool flag = true);            // Enable partial updates of the screen: only tile rows affected by the key press are redrawn and transferred to the display.
+                                                                // Takes effect with full buffer (_F) U8g2 constructors only. To disable pass false: enablePartialUpdate(false).
+    GEM_u8g2& enableDeferredDrawing(bool flag = true);          // Defer drawing of menu navigation and value changes (GEM_KEY_UP, GEM_KEY_DOWN) until GEM_u8g2::drawPending() is called,
+                                                                // so that a burst of key presses is drawn as a single frame. To disable pass false: enableDeferredDrawing(false).
+    GEM_u8g2& setMaxFrameRate(byte fps);                        // Limit how often GEM_u8g2::drawPending() draws deferred changes (frames per second). Default value 0 (no limit).
     GEM_VIRTUAL GEM_u8g2& init();                               // Init the menu (set necessary settings, display GEM splash screen, etc.)
+    GEM_VIRTUAL GEM_u8g2& initAsync();                          // Init the menu without waiting for the splash screen delay to elapse: splash screen is then advanced and dismissed by GEM_u8g2::poll() (or by the first key press)
+    bool poll();                                                // Dismiss splash screen displayed by GEM_u8g2::initAsync() once splash delay elapsed (and draw menu if menu page is set). Returns true while splash screen is displayed
     GEM_VIRTUAL GEM_u8g2& reInit();                             // Reinitialize the menu (call U8g2::initDisplay() and then reapply GEM specific settings)
     GEM_u8g2& setMenuPageCurrent(GEMPage& menuPageCurrent);     // Set supplied menu page as current
     GEMPage* getCurrentMenuPage();                              // Get pointer to current menu page
+    GEM_u8g2& setController(GEMController& controller);         // Observe navigation and edit state of the supplied controller (e.g. shared with menu object of another display),
+                                                                // menu is drawn anew on the next call to GEM_u8g2::drawMenu() or GEM_u8g2::drawPending()
+    GEMController& getController();                             // Get controller of the menu (the one set with GEM_u8g2::setController() or the own one)
 
     /* CONTEXT OPERATIONS */
 
@@ -138,10 +162,31 @@ class GEM_u8g2 {
     /* DRAW OPERATIONS */
 
     GEM_VIRTUAL GEM_u8g2& drawMenu();                           // Draw menu on screen, with menu page set earlier in GEM_u8g2::setMenuPageCurrent()
+    GEM_u8g2& drawPending();                                    // Draw changes deferred since the last frame (if any), respecting max frame rate set in GEM_u8g2::setMaxFrameRate()
+    #ifdef GEM_ENABLE_REFRESH
+    GEM_u8g2& refresh();                                        // Repaint values of visible menu items that changed since they were drawn (e.g. sensor readouts); only the affected
+                                                                // area of the screen is transferred if partial update is enabled, otherwise the whole menu is redrawn
+                                                                // (char[17], float and double values are compared by 32-bit hash: change that collides with the drawn value is not repainted)
+    #endif
     GEM_u8g2& setDrawMenuCallback(void (*drawMenuCallback_)()); // Set callback that will be called at the end of GEM_u8g2::drawMenu()
     GEM_u8g2& removeDrawMenuCallback();                         // Remove callback that was called at the end of GEM_u8g2::drawMenu()
     GEM_u8g2& setDrawSpriteCallback(bool (*drawSpriteCallback_)(u8g2_uint_t x, u8g2_uint_t y, byte spriteId, GEMItem* menuItem));  // Set callback that will be called at the start of GEM_u8g2::drawSprite()
     GEM_u8g2& removeDrawSpriteCallback();                       // Remove callback that was called at the start of GEM_u8g2::drawSprite()
+    #ifdef GEM_ENABLE_PROFILING
+    GEMProfiler& getProfiler();                                 // Get profile of the last GEM_PROFILE_FRAMES frames (count of draw primitives and time spent in each of the phases of drawing)
+    #endif
+
+    /* MENU ITEMS NAVIGATION */
+
+    GEM_u8g2& goToMenuItem(GEMIndex index);                     // Move menu pointer to the menu item with supplied index (among visible menu items of the current menu page)
+    GEM_u8g2& goToMenuItem(GEMItem& menuItem);                  // Move menu pointer to the supplied menu item of the current menu page
+    GEM_u8g2& goToFirstMenuItem();                              // Move menu pointer to the first menu item (GEM_KEY_HOME)
+    GEM_u8g2& goToLastMenuItem();                               // Move menu pointer to the last menu item (GEM_KEY_END)
+    GEM_u8g2& goToPrevScreen();                                 // Move menu pointer one screen up, stopping at the first menu item (GEM_KEY_PAGE_UP)
+    GEM_u8g2& goToNextScreen();                                 // Move menu pointer one screen down, stopping at the last menu item (GEM_KEY_PAGE_DOWN)
+    GEM_u8g2& goToPrevInteractiveMenuItem();                    // Move menu pointer to the previous menu item that is neither label nor readonly (looping over the menu page)
+    GEM_u8g2& goToNextInteractiveMenuItem();                    // Move menu pointer to the next menu item that is neither label nor readonly (looping over the menu page)
+                                                                // Menu pointer is moved at once and the menu is redrawn only once. Has no effect in edit mode
 
     /* VALUE EDIT */
 
@@ -151,85 +196,126 @@ class GEM_u8g2 {
 
     bool readyForKey();                                         // Checks that menu is waiting for the key press
     GEM_u8g2& registerKeyPress(byte keyCode);                   // Register the key press and trigger corresponding action
-                                                                // Accepts GEM_KEY_NONE, GEM_KEY_UP, GEM_KEY_RIGHT, GEM_KEY_DOWN, GEM_KEY_LEFT, GEM_KEY_CANCEL, GEM_KEY_OK values
+                                                                // Accepts GEM_KEY_NONE, GEM_KEY_UP, GEM_KEY_RIGHT, GEM_KEY_DOWN, GEM_KEY_LEFT, GEM_KEY_CANCEL, GEM_KEY_OK values,
+                                                                // as well as optional GEM_KEY_PAGE_UP, GEM_KEY_PAGE_DOWN, GEM_KEY_HOME, GEM_KEY_END navigation keys
+    #ifdef GEM_ENABLE_KEY_QUEUE
+    bool enqueueKey(byte keyCode);                              // Put the key press into the queue to be registered later by processKeys() (safe to call from interrupt service routine)
+                                                                // Returns false if the queue is full (the key press is dropped then)
+    GEM_u8g2& processKeys();                                    // Register all of the queued key presses (call it from loop() instead of readyForKey() and registerKeyPress())
+    GEMKeyQueue& getKeyQueue();                                 // Get queue of key presses (e.g. to monitor count of dropped key presses)
+    #endif
   protected:
     U8G2& _u8g2;
     GEMAppearance* _appearanceCurrent = nullptr;
     GEMAppearance _appearance;
+    GEMLayout _layout;
+    void updateLayout();                                        // Recalculate layout of the menu for current appearance, fonts and menu page
     byte getMenuItemsPerScreen();
     byte getMenuItemFontSize();
     FontSize _menuItemFont[2] = {{6,8},{4,6}};
     FontFamiliesU8g2 _fontFamilies = {GEM_FONT_BIG, GEM_FONT_SMALL};
     bool _UTF8Enabled = false;
-    bool _invertKeysDuringEdit = false;
-    GEM_VIRTUAL byte getMenuItemTitleLength();
-    GEM_VIRTUAL byte getMenuItemValueLength();
+    bool _partialUpdate = false;
+    GEM_VIRTUAL_DRAW byte getMenuItemTitleLength() GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte getMenuItemValueLength() GEM_FINAL_DRAW;
     GEMSprite _splash;
     uint16_t _splashDelay = 1000;
     bool _enableVersion = true;
+    byte _splashState = GEM_SPLASH_NONE;
+    unsigned long _splashStart = 0;
+    void drawSplashVersion();
+    void finishSplash();
+    void dismissSplash();
 
     /* DRAW OPERATIONS */
 
-    GEMPage* _menuPageCurrent = nullptr;
+    GEMController _ownController;                               // Controller of the menu unless another one is set with GEM_u8g2::setController()
+    GEMController* _controller = &_ownController;               // Navigation and edit state of the menu (current menu page, value being edited)
+    GEMView _view;                                              // What is drawn on screen (parts of the menu to be redrawn, position of the edit cursor)
     void (*drawMenuCallback)() = nullptr;
+    #ifdef GEM_ENABLE_PROFILING
+    GEMProfiler _profiler;
+    #endif
+    #ifdef GEM_ENABLE_VALUE_CACHE
+    GEMValueCache _valueCache;
+    #endif
+    #ifdef GEM_ENABLE_REFRESH
+    GEMDrawnValues _drawnValues;
+    int _clipTop = 0;                                           // Clip window of the current partial update (values outside of it are not transferred to the display)
+    int _clipBottom = 0x7FFF;
+    int _clipLeft = 0;
+    #endif
     bool (*drawSpriteCallback)(u8g2_uint_t x, u8g2_uint_t y, byte spriteId, GEMItem* menuItem) = nullptr;
     GEM_VIRTUAL void drawTitleBar();
-    GEM_VIRTUAL GEMSprite* getSprite(byte spriteId);
-    GEM_VIRTUAL void drawSprite(u8g2_uint_t x, u8g2_uint_t y, byte spriteId, GEMItem* menuItem = nullptr, bool withInsetOffset = true);
-    GEM_VIRTUAL void printMenuItemString(const char* str, byte num, byte startPos = 0);
-    GEM_VIRTUAL void printMenuItemTitle(const char* str, int offset = 0);
-    GEM_VIRTUAL void printMenuItemValue(const char* str, int offset = 0, byte startPos = 0);
-    GEM_VIRTUAL void printMenuItemFull(const char* str, int offset = 0);
-    GEM_VIRTUAL byte getMenuItemInsetOffset();
-    GEM_VIRTUAL byte getCurrentItemTopOffset(bool withInsetOffset = false);
-    GEM_VIRTUAL byte calculateSpriteOverlap(byte spriteId);
+    GEM_VIRTUAL_DRAW GEMSprite* getSprite(byte spriteId) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void drawSprite(u8g2_uint_t x, u8g2_uint_t y, byte spriteId, GEMItem* menuItem = nullptr, bool withInsetOffset = true) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemString(const char* str, byte num, byte startPos = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemTitle(const char* str, int offset = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW void printMenuItemValue(const char* str, int offset = 0, byte startPos = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW char* formatMenuItemValue(GEMItem* menuItemTmp, byte linkedType, char* valueStringTmp) GEM_FINAL_DRAW;  // Format value of the associated variable (of the supplied type) of the menu item
+    GEM_VIRTUAL_DRAW void printMenuItemFull(const char* str, int offset = 0, bool progmem = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte getMenuItemInsetOffset() GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte getCurrentItemTopOffset(bool withInsetOffset = false) GEM_FINAL_DRAW;
+    GEM_VIRTUAL_DRAW byte calculateSpriteOverlap(byte spriteId) GEM_FINAL_DRAW;
     GEM_VIRTUAL void printMenuItems();
     GEM_VIRTUAL void drawMenuPointer();
     GEM_VIRTUAL void drawScrollbar();
-
-    /* MENU ITEMS NAVIGATION */
-
-    GEM_VIRTUAL void nextMenuItem();
-    GEM_VIRTUAL void prevMenuItem();
-    GEM_VIRTUAL void menuItemSelect();
+    GEMPage* _drawnMenuPage = nullptr;                          // Menu page that was last drawn in full with GEM_u8g2::drawMenu() (partial updates are applied on top of it)
+    GEMIndex _drawnItemNum = 0;                                 // Menu item which pointer is drawn on screen
+    GEM_VIRTUAL void drawMenuContents();
+    GEM_VIRTUAL void updateMenuArea(int top, int bottom, int left = 0);
+    void updateCurrentMenuItem();
+    void updateMenuItems();                                     // Redraw rows of the changed menu items of the current screen (see GEMController::invalidateMenuItem())
+    void updateMenuPointer(GEMIndex menuItemNumPrev);
+    bool _deferredDrawing = false;
+    byte _maxFrameRate = 0;
+    unsigned long _lastFrameTime = 0;
+    void flushPendingDraw();
 
     /* VALUE EDIT */
 
-    bool _editValueMode;
-    byte _editValueType;
-    byte _editValueLength;
-    byte _editValueCursorPosition;
-    byte _editValueVirtualCursorPosition;
-    char _valueString[GEM_STR_LEN];
-    int _valueSelectNum;
-    GEM_VIRTUAL void enterEditValueMode();
-    GEM_VIRTUAL void checkboxToggle();
-    GEM_VIRTUAL void initEditValueCursor();
-    GEM_VIRTUAL void nextEditValueCursorPosition();
-    GEM_VIRTUAL void prevEditValueCursorPosition();
     GEM_VIRTUAL void drawEditValueCursor();
-    GEM_VIRTUAL void nextEditValueDigit();
-    GEM_VIRTUAL void prevEditValueDigit();
+
+    #ifdef GEM_ENABLE_ADVANCED_MODE
+
+    /* MENU ITEMS NAVIGATION AND VALUE EDIT (moved to GEMController) */
+
+    // Forward to the controller and draw the result. Declared final, so that overrides written for the earlier versions of GEM fail to compile
+    // instead of never being called: override these methods in a class derived from GEMController instead (see setController())
+    virtual void nextMenuItem() final;
+    virtual void prevMenuItem() final;
+    virtual void menuItemSelect() final;
+    virtual void enterEditValueMode() final;
+    virtual void checkboxToggle() final;
+    virtual void initEditValueCursor() final;
+    virtual void nextEditValueCursorPosition() final;
+    virtual void prevEditValueCursorPosition() final;
+    virtual void nextEditValueDigit() final;
+    virtual void prevEditValueDigit() final;
     #ifdef GEM_SUPPORT_PREVIEW_CALLBACKS
-    GEM_VIRTUAL void callPreviewCallback(bool reset = false);
+    virtual void callPreviewCallback(bool reset = false) final;
     #endif
-    GEM_VIRTUAL void drawEditValueDigit(byte code);
-    GEM_VIRTUAL void nextEditValueSelect();
-    GEM_VIRTUAL void prevEditValueSelect();
+    virtual void drawEditValueDigit(byte code) final;
+    virtual void nextEditValueSelect() final;
+    virtual void prevEditValueSelect() final;
     #ifdef GEM_SUPPORT_SPINNER
-    GEM_VIRTUAL void nextEditValueSpinner();
-    GEM_VIRTUAL void prevEditValueSpinner();
+    virtual void nextEditValueSpinner() final;
+    virtual void prevEditValueSpinner() final;
+    #endif
+    virtual void saveEditValue() final;
+    virtual void cancelEditValue() final;
+    virtual void resetEditValueState() final;
+    virtual void exitEditValue() final;
     #endif
-    GEM_VIRTUAL void saveEditValue();
-    GEM_VIRTUAL void cancelEditValue();
-    GEM_VIRTUAL void resetEditValueState();
-    GEM_VIRTUAL void exitEditValue();
-    char* trimString(char* str);
 
     /* KEY DETECTION */
 
     byte _currentKey;
+    byte translateKeyCode(byte keyCode);                        // Translate key code of GEM_u8g2 to the one handled by GEMController
     void dispatchKeyPress();
+    #ifdef GEM_ENABLE_KEY_QUEUE
+    GEMKeyQueue _keyQueue;
+    #endif
 };
 
 #endif
@@ -42,3 +42,56 @@
 #if !defined(GEM_DISABLE_ADVANCED_MODE) || defined(GEM_ENABLE_ADVANCED_MODE)
 #include "config/enable-advanced-mode.h"    // Enable Advanced Mode
 #endif
+
+// Static binding of draw helpers in Advanced Mode is disabled by default.
+// Declares methods that are called several times for each menu item drawn (e.g. printMenuItemString(), drawSprite()) final
+// in Advanced Mode, so that customized menu doesn't pay for indirect calls in the inner loop of drawing (overriding them is
+// not supported then and fails to compile). Methods called once per frame or per menu item (e.g. printMenuItems(), drawTitleBar(),
+// drawMenuPointer()) can still be overridden.
+// Can be enabled either by defining GEM_ENABLE_STATIC_DRAW (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_STATIC_DRAW             // Comment this line to enable static binding of draw helpers
+#if !defined(GEM_DISABLE_STATIC_DRAW) || defined(GEM_ENABLE_STATIC_DRAW)
+#include "config/enable-static-draw.h"      // Enable static binding of draw helpers in Advanced Mode
+#endif
+
+// Profiling of draw operations is disabled by default.
+// Records count of draw primitives and time spent in each of the phases of drawing for the last GEM_PROFILE_FRAMES frames.
+// Can be enabled either by defining GEM_ENABLE_PROFILING (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_PROFILING               // Comment this line to enable profiling
+#if !defined(GEM_DISABLE_PROFILING) || defined(GEM_ENABLE_PROFILING)
+#include "config/enable-profiling.h"        // Enable profiling of draw operations
+#endif
+
+// Support for menu pages with more than 255 menu items is disabled by default.
+// Makes indices and counts of menu items within the page (GEMIndex type) 16-bit wide, which requires a few more bytes of RAM per page.
+// Can be enabled either by defining GEM_ENABLE_WIDE_INDEX (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_WIDE_INDEX              // Comment this line to enable support for long menu pages
+#if !defined(GEM_DISABLE_WIDE_INDEX) || defined(GEM_ENABLE_WIDE_INDEX)
+#include "config/enable-wide-index.h"       // Enable 16-bit indices of menu items
+#endif
+
+// Caching of formatted values of menu items is disabled by default.
+// Keeps strings of int, byte, float and double values of the last GEM_VALUE_CACHE_SIZE drawn menu items (about 30 bytes of RAM each),
+// so that they are formatted again only when associated variable changes.
+// Can be enabled either by defining GEM_ENABLE_VALUE_CACHE (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_VALUE_CACHE             // Comment this line to enable caching of formatted values
+#if !defined(GEM_DISABLE_VALUE_CACHE) || defined(GEM_ENABLE_VALUE_CACHE)
+#include "config/enable-value-cache.h"      // Enable caching of formatted values of menu items
+#endif
+
+// Refreshing of changed values with refresh() is disabled by default.
+// Keeps values (or hashes of char[17], float and double values) of the last GEM_DRAWN_VALUES_SIZE drawn menu items (6 bytes of RAM each on AVR), so that refresh() can
+// repaint only those values of the visible menu items that changed since they were drawn.
+// Can be enabled either by defining GEM_ENABLE_REFRESH (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_REFRESH                 // Comment this line to enable refreshing of changed values
+#if !defined(GEM_DISABLE_REFRESH) || defined(GEM_ENABLE_REFRESH)
+#include "config/enable-refresh.h"          // Enable refreshing of changed values of menu items
+#endif
+
+// Queue of key presses is disabled by default.
+// Lets interrupt service routines (e.g. of rotary encoder) enqueue key presses with enqueueKey() that are later registered in loop() with processKeys().
+// Can be enabled either by defining GEM_ENABLE_KEY_QUEUE (via compiler flag or define) or manual edition here.
+#define GEM_DISABLE_KEY_QUEUE               // Comment this line to enable queue of key presses
+#if !defined(GEM_DISABLE_KEY_QUEUE) || defined(GEM_ENABLE_KEY_QUEUE)
+#include "config/enable-key-queue.h"        // Enable queue of key presses
+#endif
@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_KEY_QUEUE
+#define GEM_ENABLE_KEY_QUEUE
+#endif
\ No newline at end of file
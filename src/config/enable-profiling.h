@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_PROFILING
+#define GEM_ENABLE_PROFILING
+#endif
\ No newline at end of file
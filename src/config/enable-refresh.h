@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_REFRESH
+#define GEM_ENABLE_REFRESH
+#endif
\ No newline at end of file
@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_STATIC_DRAW
+#define GEM_ENABLE_STATIC_DRAW
+#endif
\ No newline at end of file
@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_VALUE_CACHE
+#define GEM_ENABLE_VALUE_CACHE
+#endif
\ No newline at end of file
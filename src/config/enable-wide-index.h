@@ -0,0 +1,3 @@
+#ifndef GEM_ENABLE_WIDE_INDEX
+#define GEM_ENABLE_WIDE_INDEX
+#endif
\ No newline at end of file
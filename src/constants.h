@@ -49,17 +49,23 @@
 // Macro constant (alias) for auto menu items per screen option
 #define GEM_ITEMS_COUNT_AUTO 0
 
+// Macro constants (aliases) for stages of the splash screen displayed asynchronously (see initAsync())
+#define GEM_SPLASH_NONE 0     // Splash screen is not displayed
+#define GEM_SPLASH_LOGO 1     // Splash image is displayed
+#define GEM_SPLASH_VERSION 2  // Splash image is displayed along with the version of the library
+
 // Macro constants (aliases) for supported types of associated with menu item variable
 #define GEM_VAL_INTEGER 0  // Associated variable is of type int
 #define GEM_VAL_BYTE 1     // Associated variable is of type byte
 #define GEM_VAL_CHAR 2     // Associated variable is of type char[GEM_STR_LEN]
 #define GEM_VAL_BOOL 3     // Associated variable is of type bool
 #define GEM_VAL_BOOLEAN GEM_VAL_BOOL
-#define GEM_VAL_SELECT 4   // Associated variable is either of type int, byte, char[], float or double with option select used to pick a predefined value from the list
+#define GEM_VAL_SELECT 4   // Associated variable is either of type int, byte, char[], float, double or GEMFixed with option select used to pick a predefined value from the list
                            // (note that char[] array should be big enough to hold select option with the longest value)
 #define GEM_VAL_FLOAT 5    // Associated variable is of type float
 #define GEM_VAL_DOUBLE 6   // Associated variable is of type double
-#define GEM_VAL_SPINNER 7  // Associated variable is either of type int, byte, float or double with spinner to increment or decrement value with given step
+#define GEM_VAL_SPINNER 7  // Associated variable is either of type int, byte, float, double or GEMFixed with spinner to increment or decrement value with given step
+#define GEM_VAL_FIXED 8    // Associated variable is of type GEMFixed (fixed-point decimal number)
 
 // Macro constant (alias) for loop modifier of selects (GEMSelect) and range spinners (GEMSpinner)
 #define GEM_LOOP true
@@ -79,3 +85,17 @@
 #else
 #define GEM_VIRTUAL
 #endif
+
+// Macros used internally to mark virtual functions in Advanced Mode that are called several times for each menu item drawn
+// (e.g. printMenuItemString(), drawSprite()); these are declared final if GEM_ENABLE_STATIC_DRAW is defined, so that
+// calls to them are bound statically and attempt to override any of them in a derived class fails to compile
+#ifdef GEM_ENABLE_ADVANCED_MODE
+#define GEM_VIRTUAL_DRAW virtual
+#else
+#define GEM_VIRTUAL_DRAW
+#endif
+#if defined(GEM_ENABLE_ADVANCED_MODE) && defined(GEM_ENABLE_STATIC_DRAW)
+#define GEM_FINAL_DRAW final
+#else
+#define GEM_FINAL_DRAW
+#endif